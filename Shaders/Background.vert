@@ -0,0 +1,22 @@
+// Request GLSL 3.3
+#version 330
+
+// Screen-covering quad in pixels; the texture repeats across the world
+layout (location = 0) in vec2 inPosition;
+
+out vec2 fragTexCoord;
+
+uniform mat4 uOrthoProj;
+// World position under the top-left corner of the screen
+uniform vec2 uOrigin;
+uniform vec2 uTileSize;
+
+void main()
+{
+	gl_Position = uOrthoProj * vec4(inPosition, 0.0, 1.0);
+
+	// Tiles are centered on multiples of the tile size, with v growing
+	// upwards like the unflipped sprite quad
+	vec2 tile = (uOrigin + inPosition + 0.5 * uTileSize) / uTileSize;
+	fragTexCoord = vec2(tile.x, -tile.y);
+}
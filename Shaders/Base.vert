@@ -17,11 +17,15 @@ layout (location = 1) in vec2 inTexCoord;
 out vec2 fragTexCoord;
 
 uniform mat4 uWorldTransform;
-uniform mat4 uOrthoProj;
+// Camera and projection, uploaded once per frame (see Renderer::SetCamera)
+layout (std140) uniform ViewBlock
+{
+	mat4 uViewProj;
+};
 
 void main()
 {
-	gl_Position = uOrthoProj * uWorldTransform * vec4(inPosition, 1.0);
+	gl_Position = uViewProj * uWorldTransform * vec4(inPosition, 1.0);
 	fragTexCoord = inTexCoord;
 }
 
@@ -0,0 +1,11 @@
+// Request GLSL 3.3
+#version 330
+
+in vec3 fragColor;
+
+out vec4 outColor;
+
+void main()
+{
+	outColor = vec4(fragColor, 1.0);
+}
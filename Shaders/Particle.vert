@@ -0,0 +1,20 @@
+// Request GLSL 3.3
+#version 330
+
+// Particles are batched in world space: position (xy) and colour (rgb) per vertex
+layout (location = 0) in vec2 inPosition;
+layout (location = 1) in vec3 inColor;
+
+out vec3 fragColor;
+
+// View-projection shared with the other world shaders
+layout (std140) uniform ViewBlock
+{
+	mat4 uViewProj;
+};
+
+void main()
+{
+	gl_Position = uViewProj * vec4(inPosition, 0.0, 1.0);
+	fragColor = inColor;
+}
@@ -0,0 +1,26 @@
+// Request GLSL 3.3
+#version 330
+
+in vec2 fragLocal;
+flat in vec2 fragRadiusThickness;
+flat in vec3 fragColor;
+flat in vec2 fragFillAlpha;
+
+out vec4 outColor;
+
+void main()
+{
+	float distance = length(fragLocal);
+	float radius = fragRadiusThickness.x;
+	float halfThickness = 0.5 * fragRadiusThickness.y;
+
+	// Signed distance to the outline and to the disk, one pixel of smoothing
+	float ring = 1.0 - smoothstep(-0.5, 0.5, abs(distance - radius) - halfThickness);
+	float inside = 1.0 - smoothstep(-0.5, 0.5, distance - radius);
+
+	float alpha = max(ring, inside * fragFillAlpha.x) * fragFillAlpha.y;
+	if (alpha <= 0.0) {
+		discard;
+	}
+	outColor = vec4(fragColor, alpha);
+}
@@ -0,0 +1,35 @@
+// Request GLSL 3.3
+#version 330
+
+// Per vertex: the sprite quad (position xyz, corners at +-0.5)
+layout (location = 0) in vec3 inPosition;
+
+// Per instance: world center, radius and thickness, color, fill and alpha
+layout (location = 1) in vec2 inCenter;
+layout (location = 2) in vec2 inRadiusThickness;
+layout (location = 3) in vec3 inColor;
+layout (location = 4) in vec2 inFillAlpha;
+
+// Offset from the center in pixels
+out vec2 fragLocal;
+flat out vec2 fragRadiusThickness;
+flat out vec3 fragColor;
+flat out vec2 fragFillAlpha;
+
+// Same view block as the sprites
+layout (std140) uniform ViewBlock
+{
+	mat4 uViewProj;
+};
+
+void main()
+{
+	// Cover the outline plus a pixel for antialiasing
+	float extent = inRadiusThickness.x + 0.5 * inRadiusThickness.y + 1.0;
+	fragLocal = inPosition.xy * (2.0 * extent);
+
+	gl_Position = uViewProj * vec4(inCenter + fragLocal, 0.0, 1.0);
+	fragRadiusThickness = inRadiusThickness;
+	fragColor = inColor;
+	fragFillAlpha = inFillAlpha;
+}
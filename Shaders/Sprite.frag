@@ -0,0 +1,20 @@
+// Request GLSL 3.3
+#version 330
+
+in vec2 fragTexCoord;
+in vec3 fragColor;
+in float fragTextureFactor;
+
+out vec4 outColor;
+
+uniform sampler2D uTexture;
+
+void main()
+{
+	// Same rule as Base.frag: textured when the factor is positive, else solid
+	if (fragTextureFactor > 0.0) {
+		outColor = texture(uTexture, fragTexCoord) * vec4(fragColor, 1.0);
+	} else {
+		outColor = vec4(fragColor, 1.0);
+	}
+}
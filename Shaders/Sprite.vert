@@ -0,0 +1,26 @@
+// Request GLSL 3.3
+#version 330
+
+// Sprite batch vertex: position, tex coords, tint and texture factor
+layout (location = 0) in vec2 inPosition;
+layout (location = 1) in vec2 inTexCoord;
+layout (location = 2) in vec3 inColor;
+layout (location = 3) in float inTextureFactor;
+
+out vec2 fragTexCoord;
+out vec3 fragColor;
+out float fragTextureFactor;
+
+// World view for the sprite batch, screen-space view for the UI
+layout (std140) uniform ViewBlock
+{
+	mat4 uViewProj;
+};
+
+void main()
+{
+	gl_Position = uViewProj * vec4(inPosition, 0.0, 1.0);
+	fragTexCoord = inTexCoord;
+	fragColor = inColor;
+	fragTextureFactor = inTextureFactor;
+}
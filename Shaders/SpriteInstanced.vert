@@ -0,0 +1,35 @@
+// Request GLSL 3.3
+#version 330
+
+// Per vertex: the sprite quad (position xyz, tex coords uv)
+layout (location = 0) in vec3 inPosition;
+layout (location = 1) in vec2 inTexCoord;
+
+// Per instance: world position, size (negative x mirrors), rotation, uv rect, tint
+layout (location = 2) in vec2 inOffset;
+layout (location = 3) in vec2 inSize;
+layout (location = 4) in float inRotation;
+layout (location = 5) in vec4 inTexRect;
+layout (location = 6) in vec3 inColor;
+
+out vec2 fragTexCoord;
+out vec3 fragColor;
+
+// Camera and projection (Renderer::SetCamera)
+layout (std140) uniform ViewBlock
+{
+	mat4 uViewProj;
+};
+
+void main()
+{
+	// Scale, rotate, translate (same order as the sprite model matrix)
+	vec2 pos = inPosition.xy * inSize;
+	float c = cos(inRotation);
+	float s = sin(inRotation);
+	pos = vec2(pos.x * c - pos.y * s, pos.x * s + pos.y * c) + inOffset;
+
+	gl_Position = uViewProj * vec4(pos, 0.0, 1.0);
+	fragTexCoord = inTexRect.xy + inTexCoord * inTexRect.zw;
+	fragColor = inColor;
+}
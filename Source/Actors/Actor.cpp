@@ -14,13 +14,17 @@
 Actor::Actor(Game* game)
         : mState(ActorState::Active)
         , mPosition(Vector2::Zero)
+        , mPrevPosition(Vector2::Zero)
+        , mHasPrevPosition(false)
         , mScale(Vector2(1.0f, 1.0f))
         , mRotation(0.0f)
         , mGame(game)
+        , mType(ActorType::Generic)
+        , mListIndex(-1)
         , mLifetime(-1.0f) // <-- INICIALIZAÇÃO AQUI
 {
 
-    mGame->AddActor(this);
+    mHandle = mGame->AddActor(this);
 }
 
 Actor::~Actor()
@@ -97,10 +101,37 @@ void Actor::AddComponent(Component* c)
     });
 }
 
+void Actor::RemoveComponent(Component* c)
+{
+    auto iter = std::find(mComponents.begin(), mComponents.end(), c);
+    if (iter != mComponents.end())
+    {
+        mComponents.erase(iter);
+    }
+}
+
 Matrix4 Actor::GetModelMatrix() const
 {
     Matrix4 scaleMat = Matrix4::CreateScale(mScale.x, mScale.y, 1.0f);
     Matrix4 rotMat   = Matrix4::CreateRotationZ(mRotation);
     Matrix4 transMat = Matrix4::CreateTranslation(Vector3(mPosition.x, mPosition.y, 0.0f));
     return scaleMat * rotMat * transMat;
-}
\ No newline at end of file
+}
+
+Vector2 Actor::GetRenderPosition() const
+{
+    if (!mHasPrevPosition)
+    {
+        return mPosition;
+    }
+    return Vector2::Lerp(mPrevPosition, mPosition, mGame->GetRenderAlpha());
+}
+
+Matrix4 Actor::GetRenderModelMatrix() const
+{
+    Vector2 position = GetRenderPosition();
+    Matrix4 scaleMat = Matrix4::CreateScale(mScale.x, mScale.y, 1.0f);
+    Matrix4 rotMat   = Matrix4::CreateRotationZ(mRotation);
+    Matrix4 transMat = Matrix4::CreateTranslation(Vector3(position.x, position.y, 0.0f));
+    return scaleMat * rotMat * transMat;
+}
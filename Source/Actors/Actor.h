@@ -11,6 +11,7 @@
 #include <SDL_stdinc.h>
 #include "../Math.h"
 #include "../Renderer/Renderer.h"
+#include "../Systems/ActorRegistry.h"
 
 enum class ActorState
 {
@@ -19,6 +20,17 @@ enum class ActorState
     Destroy
 };
 
+// Tag set by each actor type in its constructor, so code that only needs the
+// concrete type doesn't have to go through dynamic_cast
+enum class ActorType
+{
+    Generic,
+    Player,
+    Enemy,
+    Boss,
+    ExperienceOrb
+};
+
 class Actor
 {
 public:
@@ -29,7 +41,14 @@ public:
     void ProcessInput(const Uint8* keyState);
 
     const Vector2& GetPosition() const { return mPosition; }
-    void SetPosition(const Vector2& pos) { mPosition = pos; }
+    // Virtual so actors that mirror their position elsewhere (Enemy) see every write
+    virtual void SetPosition(const Vector2& pos) { mPosition = pos; }
+
+    // Position at the start of the current simulation step; actors created
+    // during a step have none yet and are drawn at their current position
+    void SavePreviousPosition() { mPrevPosition = mPosition; mHasPrevPosition = true; }
+    // Position interpolated between the last two steps, for drawing
+    Vector2 GetRenderPosition() const;
 
     const Vector2& GetScale() const { return mScale; }
     void SetScale(const Vector2& scale) { mScale = scale; }
@@ -47,28 +66,23 @@ public:
     Vector2 GetForward() const { return Vector2(Math::Cos(mRotation), Math::Sin(mRotation)); }
 
     Matrix4 GetModelMatrix() const;
+    Matrix4 GetRenderModelMatrix() const;
 
     class Game* GetGame() { return mGame; }
+    ActorHandle GetHandle() const { return mHandle; }
+    ActorType GetType() const { return mType; }
 
-    const std::vector<class Component*>& GetComponents() const { return mComponents; }
+    // Position of this actor in its Game typed list (enemies, orbs), -1 if none
+    int GetListIndex() const { return mListIndex; }
+    void SetListIndex(int index) { mListIndex = index; }
 
-    template <typename T>
-    T* GetComponent() const
-    {
-        for (auto c : mComponents)
-        {
-            T* t = dynamic_cast<T*>(c);
-            if (t != nullptr)
-            {
-                return t;
-            }
-        }
-
-        return nullptr;
-    }
+    const std::vector<class Component*>& GetComponents() const { return mComponents; }
 
 protected:
     class Game* mGame;
+    ActorHandle mHandle;
+    ActorType mType;
+    int mListIndex;
 
     virtual void OnUpdate(float deltaTime);
     virtual void OnProcessInput(const Uint8* keyState);
@@ -76,6 +90,8 @@ protected:
     ActorState mState;
 
     Vector2 mPosition;
+    Vector2 mPrevPosition;
+    bool mHasPrevPosition;
     Vector2 mScale;
     float mRotation;
 
@@ -85,6 +101,9 @@ protected:
 
     std::vector<class Component*> mComponents;
 
+    // Detaches a component without deleting it
+    void RemoveComponent(class Component* c);
+
 private:
     friend class Component;
 
@@ -8,9 +8,13 @@ public:
     ~Background();
     
     void Draw(class Renderer* renderer);
+
+    // 1 moves with the world; smaller values scroll slower, like a far layer
+    void SetParallax(float parallax) { mParallax = parallax; }
     
 private:
     class Texture* mTexture;
     float mTileWidth;
     float mTileHeight;
+    float mParallax;
 };
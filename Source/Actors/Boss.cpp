@@ -22,7 +22,9 @@ Boss::Boss(Game* game, BossKind kind, int waveLevel)
     , mBossColor(Vector3::One)        // Inicializa a cor base
     , mAttackCounter(0) // <-- ADICIONE A INICIALIZAÇÃO
     , mCurrentDirection(BossDirection::Front)
+    , mBossListIndex(-1)
 {
+    mType = ActorType::Boss;
     game->AddBoss(this);
     // (Não removemos o inimigo daqui, pois o ~Enemy já faz isso na morte)
 
@@ -49,17 +51,15 @@ Boss::Boss(Game* game, BossKind kind, int waveLevel)
     }
 
     // --- APLICA O ESCALAMENTO DA WAVE ---
-    mHealth = baseHealth + (waveLevel * 50.0f);
-    mMaxHealth = mHealth; // Importante para a barra de vida
-    mSpeed = baseSpeed + (waveLevel * 2.0f);
+    SetMaxHealth(baseHealth + (waveLevel * 50.0f)); // Importante para a barra de vida
+    SetSpeed(baseSpeed + (waveLevel * 2.0f));
+
+    // O Boss controla a própria velocidade; o EnemySystem só integra
+    SetChasesPlayer(false);
 
     if (mAnimatorComponent)
     {
-        auto iter = std::find(mComponents.begin(), mComponents.end(), (Component*)mAnimatorComponent);
-        if (iter != mComponents.end())
-        {
-            mComponents.erase(iter);
-        }
+        RemoveComponent(mAnimatorComponent);
         delete mAnimatorComponent;
         mAnimatorComponent = nullptr;
     }
@@ -82,7 +82,7 @@ Boss::Boss(Game* game, BossKind kind, int waveLevel)
     
     SetScale(Vector2(1.0f, -1.0f));
 
-    mCircleColliderComponent->SetRadius(baseRadius);
+    SetRadius(baseRadius);
     // -------------------------------------------
 
     SetExperienceValue(100.0f * waveLevel);
@@ -150,7 +150,7 @@ void Boss::ChangeState(BossState newState)
 void Boss::OnUpdate(float deltaTime)
 {
     // 1. Lógica de Morte
-    if (mHealth <= 0.0f)
+    if (GetHealth() <= 0.0f)
     {
         if (auto* player = GetGame()->GetPlayer())
         {
@@ -268,7 +268,7 @@ void Boss::OnUpdate(float deltaTime)
 
 void Boss::UpdateSpawning(float deltaTime)
 {
-    mRigidBodyComponent->SetVelocity(Vector2(0.0f, 60.0f));
+    SetVelocity(Vector2(0.0f, 60.0f));
 }
 
 void Boss::UpdateChasing(float deltaTime)
@@ -279,7 +279,7 @@ void Boss::UpdateChasing(float deltaTime)
 void Boss::UpdateBurstAttack(float deltaTime)
 {
     // ... (código original do BurstAttack) ...
-    mRigidBodyComponent->SetVelocity(Vector2::Zero);
+    SetVelocity(Vector2::Zero);
     mAttackSubTimer -= deltaTime;
     if (mAttackSubTimer <= 0.0f)
     {
@@ -312,13 +312,13 @@ void Boss::UpdateSpiralAttack(float deltaTime)
 
 void Boss::UpdateCooldown(float deltaTime)
 {
-    mRigidBodyComponent->SetVelocity(Vector2::Zero);
+    SetVelocity(Vector2::Zero);
 }
 
 void Boss::UpdateTelegraphing(float deltaTime)
 {
     // ... (código original do Telegraphing) ...
-    mRigidBodyComponent->SetVelocity(Vector2::Zero);
+    SetVelocity(Vector2::Zero);
     if (mTargetDirection.LengthSq() < 1e-4f)
     {
         auto* player = GetGame()->GetPlayer();
@@ -336,9 +336,9 @@ void Boss::UpdateTelegraphing(float deltaTime)
 
 void Boss::UpdateDashing(float deltaTime)
 {
-    if (mRigidBodyComponent->GetVelocity().LengthSq() < 1.0f)
+    if (GetVelocity().LengthSq() < 1.0f)
     {
-        mRigidBodyComponent->SetVelocity(mTargetDirection * 800.0f);
+        SetVelocity(mTargetDirection * 800.0f);
     }
     mTargetDirection = Vector2::Zero;
 }
@@ -346,7 +346,7 @@ void Boss::UpdateDashing(float deltaTime)
 void Boss::UpdateBombing(float deltaTime)
 {
     // ... (código original do Bombing) ...
-    mRigidBodyComponent->SetVelocity(Vector2::Zero);
+    SetVelocity(Vector2::Zero);
     mAttackSubTimer -= deltaTime;
     if (mAttackSubTimer <= 0.0f)
     {
@@ -367,7 +367,7 @@ void Boss::UpdateBombing(float deltaTime)
 void Boss::UpdateConeAttack(float deltaTime)
 {
     // 1. Para de se mover
-    mRigidBodyComponent->SetVelocity(Vector2::Zero);
+    SetVelocity(Vector2::Zero);
 
     // 2. "Aquecimento"
     if (mAttackSubTimer > 0.0f) {
@@ -414,7 +414,7 @@ void Boss::UpdateMineLayer(float deltaTime)
             dir.Normalize();
             // --- ALTERAÇÃO AQUI ---
             // Use a velocidade normal (mSpeed) multiplicada (ex: 1.5x ou 2x)
-            mRigidBodyComponent->SetVelocity(dir * (mSpeed * 1.5f));
+            SetVelocity(dir * (GetSpeed() * 1.5f));
         }
     }
 
@@ -431,7 +431,7 @@ void Boss::UpdateMineLayer(float deltaTime)
 void Boss::UpdateFireBeam(float deltaTime)
 {
     // 1. Para de se mover
-    mRigidBodyComponent->SetVelocity(Vector2::Zero);
+    SetVelocity(Vector2::Zero);
 
     // 2. Atira (só no primeiro frame deste estado)
     if (mTargetDirection.LengthSq() > 1e-4f) // Se a mira foi definida
@@ -496,11 +496,11 @@ void Boss::ChasePlayer(float deltaTime)
     if (distance > 0.01f)
     {
         dir.Normalize();
-        mRigidBodyComponent->SetVelocity(dir * mSpeed);
+        SetVelocity(dir * GetSpeed());
         UpdateAnimation(dir);
     }
 
-    if (distance <= (mCircleColliderComponent->GetRadius() + 15.0f))
+    if (distance <= (GetRadius() + EnemySystem::CONTACT_MARGIN))
     {
         player->TakeDamage(20.0f * deltaTime);
         GetGame()->AddScreenShake(3.0f, 0.10f);
@@ -37,6 +37,10 @@ public:
     ~Boss();
     void OnUpdate(float deltaTime) override;
 
+    // Position in Game's boss list (bosses are also in the enemy list, which uses mListIndex)
+    int GetBossListIndex() const { return mBossListIndex; }
+    void SetBossListIndex(int index) { mBossListIndex = index; }
+
 private:
     void ChangeState(BossState newState);
 
@@ -74,4 +78,6 @@ private:
 
     int mAttackCounter;
     BossDirection mCurrentDirection;
+
+    int mBossListIndex;
 };
\ No newline at end of file
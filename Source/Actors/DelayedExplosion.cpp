@@ -1,7 +1,7 @@
 #include "DelayedExplosion.h"
 #include "../Game.h"
 #include "Player.h"
-#include "../Components/DrawComponent.h"
+#include "../Components/RingComponent.h"
 #include "../Math.h"
 #include "../Random.h" // Se quiser posições aleatórias
 
@@ -12,20 +12,9 @@ DelayedExplosion::DelayedExplosion(Game* game, Vector2 position, float delay, fl
 {
     SetPosition(position);
 
-    // Cria o anel de AVISO
-    std::vector<Vector2> vertices;
-    const int numVertices = 32;
-    for (int i = 0; i < numVertices; ++i)
-    {
-        float angle = (Math::TwoPi / numVertices) * i;
-        vertices.emplace_back(Vector2(Math::Cos(angle) * mRadius, Math::Sin(angle) * mRadius));
-    }
-    vertices.emplace_back(vertices[0]); // Fecha o loop
-
-    auto* drawComp = new DrawComponent(this, vertices);
-    drawComp->SetColor(Vector3(1.0f, 0.1f, 0.1f)); // Vermelho brilhante
-    drawComp->SetFilled(false); // Apenas o anel
-    drawComp->SetUseCamera(true);
+    // Cria o anel de AVISO, com a área levemente preenchida
+    auto* ring = new RingComponent(this, mRadius, Vector3(1.0f, 0.1f, 0.1f)); // Vermelho brilhante
+    ring->SetFill(0.12f);
 }
 
 void DelayedExplosion::OnUpdate(float deltaTime)
@@ -1,23 +1,21 @@
 #include "Enemy.h"
 #include "../Game.h"
 #include "../Random.h"
-#include "Projectile.h"
 #include "Player.h"
 #include "../Components/CircleColliderComponent.h"
-#include "../Components/RigidBodyComponent.h"
 #include "../Components/AnimatorComponent.h"
 #include "../Math.h"
 
 Enemy::Enemy(class Game* game, EnemyKind kind, float radius, float speed, float health)
     : Actor(game)
-    , mHealth(health)
-    , mMaxHealth(health)
-    , mSpeed(speed)
-    , mRadius(radius)
-    , mKind(kind)
     , mCurrentDirection(EnemyDirection::Front)
     , mWasCritKilled(false)
 {
+    mType = ActorType::Enemy;
+
+    // Registra primeiro: vida, velocidade, raio etc. ficam no EnemySystem
+    game->AddEnemy(this, kind, radius, speed, health);
+
     // Configure sprite based on enemy type
     std::string spritePath;
     std::string jsonPath;
@@ -57,7 +55,8 @@ Enemy::Enemy(class Game* game, EnemyKind kind, float radius, float speed, float
             break;
     }
     
-    mAnimatorComponent = new AnimatorComponent(this, spritePath, jsonPath, width, height);
+    mAnimatorComponent = new AnimatorComponent(this, spritePath, jsonPath, width, height,
+                                               EnemySystem::DRAW_ORDER);
     
     // Setup animations based on enemy type
     if (kind == EnemyKind::Comum)
@@ -96,13 +95,13 @@ Enemy::Enemy(class Game* game, EnemyKind kind, float radius, float speed, float
     mAnimatorComponent->SetAnimation("Front");
     mAnimatorComponent->SetAnimFPS(6.0f);
 
-    mRigidBodyComponent = new RigidBodyComponent(this, 1.0f);
+    // Desenhado pelo EnemySystem junto com os outros do mesmo tipo
+    mAnimatorComponent->SetInstanced(true);
+
     mCircleColliderComponent = new CircleColliderComponent(this, radius);
 
     // timers de tiro
     mShootTimer = mShootEvery;
-
-    game->AddEnemy(this);
 }
 
 Enemy::~Enemy()
@@ -163,6 +162,24 @@ void Enemy::SetColor(const Vector3& c)
 
 }
 
+void Enemy::SetPosition(const Vector2& position)
+{
+    Actor::SetPosition(position);
+    GetSystem().SetPosition(Slot(), position);
+}
+
+void Enemy::SetRadius(float radius)
+{
+    mCircleColliderComponent->SetRadius(radius);
+    GetSystem().SetRadius(Slot(), radius);
+}
+
+void Enemy::SetMaxHealth(float health)
+{
+    GetSystem().SetMaxHealth(Slot(), health);
+    GetSystem().SetHealth(Slot(), health);
+}
+
 void Enemy::OnUpdate(float deltaTime)
 {
     // Don't update if game is over or player is dead
@@ -172,33 +189,18 @@ void Enemy::OnUpdate(float deltaTime)
         return;
     }
     
-    // movimentação geral
-    ChasePlayer(deltaTime);
+    // movimentação geral (perseguição e dano por contato rodam no EnemySystem)
+    const Vector2& velocity = GetVelocity();
+    if (velocity.LengthSq() > 0.0f)
+    {
+        UpdateAnimation(velocity);
+    }
 
     // tiro à distância (somente se marcado como ranged)
     TryShootAtPlayer(deltaTime);
 
-    // colisão com projéteis do jogador
-    // (player already declared above)
-
-    for (auto projectile : GetGame()->GetProjectiles())
-    {
-        // projetil do jogador?
-        // A lógica "quem atirou" está no Projectile (flag fromPlayer)
-        auto circle = projectile->GetComponent<CircleColliderComponent>();
-        if (!circle) continue;
-
-        if (mCircleColliderComponent->Intersect(*circle))
-        {
-            // damage do projétil é aplicado dentro do Projectile no acerto do inimigo
-            // Aqui só marcamos que levou dano (Projectile já chama TakeDamage no inimigo?).
-            // Caso a sua implementação do Projectile não chame, mantemos o dano aqui:
-            // (Se já estiver no Projectile, remover este bloco para evitar dano duplo)
-        }
-    }
-
     // morte
-    if (mHealth <= 0.0f)
+    if (GetHealth() <= 0.0f)
     {
         // Efeitos de morte - no particles, just explosion ring if explosive
         if (mExplodesOnDeath)
@@ -226,31 +228,6 @@ void Enemy::OnUpdate(float deltaTime)
     }
 }
 
-void Enemy::ChasePlayer(float deltaTime)
-{
-    auto player = GetGame()->GetPlayer();
-    if (!player) return;
-
-    Vector2 playerPos = player->GetPosition();
-    Vector2 enemyPos  = GetPosition();
-    Vector2 dir = playerPos - enemyPos;
-
-    float distance = dir.Length();
-    if (distance > 0.01f)
-    {
-        dir.Normalize();
-        mRigidBodyComponent->SetVelocity(dir * mSpeed);
-        UpdateAnimation(dir);
-    }
-
-    // dano por contato (DPS leve ao encostar)
-    if (distance <= (mRadius + 15.0f))
-    {
-        player->TakeDamage(mDamage * 0.5f * deltaTime); // suaviza por deltaTime
-        GetGame()->AddScreenShake(3.0f, 0.10f);
-    }
-}
-
 void Enemy::TryShootAtPlayer(float deltaTime)
 {
     if (!mIsRangedShooter) return;
@@ -275,11 +252,11 @@ void Enemy::TryShootAtPlayer(float deltaTime)
     }
 
     // offset para não nascer em cima do inimigo
-    const float muzzleOffset = mRadius + 6.0f;
+    const float muzzleOffset = GetRadius() + 6.0f;
     Vector2 spawnPos = from + dir * muzzleOffset;
 
-    // dispara projétil "do inimigo": fromPlayer = false, dano = mDamage
-    GetGame()->SpawnProjectile(spawnPos, dir, mProjectileSpeed, /*fromPlayer*/ false, /*damage*/ mDamage);
+    // dispara projétil "do inimigo": fromPlayer = false, dano = GetDamage()
+    GetGame()->SpawnProjectile(spawnPos, dir, mProjectileSpeed, /*fromPlayer*/ false, /*damage*/ GetDamage());
 
     // reseta timer
     mShootTimer = mShootEvery;
@@ -287,10 +264,11 @@ void Enemy::TryShootAtPlayer(float deltaTime)
 
 float Enemy::TakeDamage(float damage)
 {
-    float old = mHealth;
-    mHealth -= damage;
-    if (mHealth < 0.0f) mHealth = 0.0f;
-    return old - mHealth;
+    float old = GetHealth();
+    float health = old - damage;
+    if (health < 0.0f) health = 0.0f;
+    GetSystem().SetHealth(Slot(), health);
+    return old - health;
 }
 
 void Enemy::DoDeathExplosion()
@@ -1,4 +1,5 @@
 #pragma once
+#include <cassert>
 #include "Actor.h"
 #include "../Game.h"
 
@@ -18,14 +19,28 @@ public:
 
     void OnUpdate(float deltaTime) override;
 
-    // --- getters básicos ---
-    float GetHealth() const { return mHealth; }
-    float GetRadius() const { return mRadius; }
-    float GetMaxHealth() const { return mMaxHealth; }
+    // --- getters básicos (dados de simulação vivem no EnemySystem) ---
+    float GetHealth() const { return GetSystem().GetHealth(Slot()); }
+    float GetRadius() const { return GetSystem().GetRadius(Slot()); }
+    class CircleColliderComponent* GetCollider() const { return mCircleColliderComponent; }
+    class AnimatorComponent* GetAnimator() const { return mAnimatorComponent; }
+    float GetMaxHealth() const { return GetSystem().GetMaxHealth(Slot()); }
+    float GetSpeed() const { return GetSystem().GetSpeed(Slot()); }
+    float GetDamage() const { return GetSystem().GetDamage(Slot()); }
+    EnemyKind GetKind() const { return GetSystem().GetKind(Slot()); }
+
+    const Vector2& GetVelocity() const { return GetSystem().GetVelocity(Slot()); }
+    void SetVelocity(const Vector2& velocity) { GetSystem().SetVelocity(Slot(), velocity); }
+
+    // Also writes the simulated position, so calls through Actor* stay in sync
+    void SetPosition(const Vector2& position) override;
+    void SetRadius(float radius);
 
     // --- atributos expostos/setters usados pelo Game ---
-    void SetSpeed(float s) { mSpeed = s; }
-    void SetDamage(float d) { mDamage = d; }
+    void SetSpeed(float s) { GetSystem().SetSpeed(Slot(), s); }
+    void SetDamage(float d) { GetSystem().SetDamage(Slot(), d); }
+    void SetMaxHealth(float health);
+    void SetChasesPlayer(bool chases) { GetSystem().SetChasesPlayer(Slot(), chases); }
     void SetExperienceValue(float xp) { mExperienceValue = xp; }
 
     void SetExplodesOnDeath(bool v) { mExplodesOnDeath = v; }
@@ -48,35 +63,31 @@ public:
     float TakeDamage(float damage);
 
 protected:
-    void ChasePlayer(float deltaTime);
     void UpdateAnimation(const Vector2& directionToPlayer);
 
+    EnemySystem& GetSystem() const { return mGame->GetEnemySystem(); }
+    // Index into the EnemySystem arrays; only valid while registered
+    // (Remove and Clear reset it to -1)
+    int Slot() const
+    {
+        assert(mListIndex >= 0 && static_cast<size_t>(mListIndex) < GetSystem().Size());
+        return mListIndex;
+    }
+
     // Variáveis que o Boss precisa
-    float mHealth;
-    float mMaxHealth;
     float mExperienceValue = 10.0f;
 
-    float mSpeed;
-
     // Componentes que o Boss precisa
-    class RigidBodyComponent* mRigidBodyComponent;
     class AnimatorComponent* mAnimatorComponent;
     class CircleColliderComponent* mCircleColliderComponent;
 
     class DrawComponent* mDrawComponent;
-    EnemyKind mKind;
     EnemyDirection mCurrentDirection;
 
 private:
     void TryShootAtPlayer(float deltaTime);
     void DoDeathExplosion(); // usado para o Gordo Explosivo
 
-
-    float mRadius;
-
-    // novo: combate
-    float mDamage = 10.0f;          // dano por contato ou base para inimigos
-
     // explosão (Gordo Explosivo)
     bool  mExplodesOnDeath = false;
     float mExplosionDamage = 40.0f;
@@ -14,6 +14,8 @@ ExperienceOrb::ExperienceOrb(class Game* game, const Vector2& position, float ex
     , mFloatPhase(Random::GetFloatRange(0.0f, Math::TwoPi))
     , mCollected(false)
 {
+    mType = ActorType::ExperienceOrb;
+
     SetPosition(position);
     SetScale(Vector2(1.0f, -1.0f));
     
@@ -96,95 +98,61 @@ void ExperienceOrb::OnUpdate(float deltaTime)
     pos.y += Math::Sin(mFloatPhase) * 0.5f;  // Gentle floating
     SetPosition(pos);
     
-    // Check for player collection - add null checks everywhere
-    
-    auto* player = game->GetPlayer();
-    if (!player || player->GetState() != ActorState::Active || player->GetHealth() <= 0.0f)
+    // Friction to slow down over time (magnet and collection are driven by Player)
+    Vector2 vel = mRigidBodyComponent->GetVelocity();
+    vel *= (1.0f - deltaTime * 2.0f);  // Decay velocity
+    if (vel.Length() < 5.0f)
+    {
+        vel = Vector2::Zero;
+    }
+    mRigidBodyComponent->SetVelocity(vel);
+}
+
+void ExperienceOrb::UpdatePickup(Player* player, float deltaTime)
+{
+    if (mCollected || GetState() != ActorState::Active)
     {
-        // Player not available or dead, skip collection check
-        // But continue with magnet effect if player exists
-        if (player && mRigidBodyComponent)
-        {
-            // Magnet effect - pull toward player if close
-            Vector2 toPlayer = player->GetPosition() - GetPosition();
-            float distance = toPlayer.Length();
-            if (distance < 250.0f && distance > 5.0f)  // Increased range
-            {
-                toPlayer.Normalize();
-                float pullStrength = (250.0f - distance) / 250.0f;
-                Vector2 pullForce = toPlayer * pullStrength * 800.0f * deltaTime;  // Much stronger pull (was 500.0f)
-                mRigidBodyComponent->SetVelocity(mRigidBodyComponent->GetVelocity() + pullForce);
-                
-                Vector2 vel = mRigidBodyComponent->GetVelocity();
-                if (vel.Length() > 450.0f)  // Higher max speed (was 300.0f)
-                {
-                    vel.Normalize();
-                    mRigidBodyComponent->SetVelocity(vel * 450.0f);
-                }
-            }
-        }
         return;
     }
-    
-    auto* playerCollider = player->GetComponent<CircleColliderComponent>();
-    if (playerCollider && mCircleColliderComponent && mCircleColliderComponent->Intersect(*playerCollider))
+
+    if (!player || !mCircleColliderComponent || !mRigidBodyComponent)
+    {
+        return;
+    }
+
+    auto* playerCollider = player->GetCollider();
+    if (playerCollider && mCircleColliderComponent->Intersect(*playerCollider))
     {
-        // CRITICAL: Check if already collected to prevent double collection
-        if (mCollected) return;
-        
         // Collect the orb - mark as collected IMMEDIATELY to prevent double collection
         mCollected = true;
-        
-        // Store ALL values we need BEFORE any state changes or component access
-        Vector2 orbPosition = GetPosition();
-        float expValue = mExperienceValue;
-        
+
         // CRITICAL: Add deferred experience BEFORE marking as Destroy
-        // This ensures the experience is queued before any cleanup happens
-        if (game)
-        {
-            Game::DeferredExperience deferred;
-            deferred.amount = expValue;
-            deferred.position = orbPosition;
-            game->AddDeferredExperience(deferred);
-        }
-        
-        // Mark for destruction LAST - this prevents any further updates
+        Game::DeferredExperience deferred;
+        deferred.amount = mExperienceValue;
+        deferred.position = GetPosition();
+        GetGame()->AddDeferredExperience(deferred);
+
         // Game::UpdateActors will safely handle removal from list before deletion
         SetState(ActorState::Destroy);
-        
-        return;  // Exit immediately - don't do anything else
+        return;
     }
-    
+
     // Magnet effect - pull toward player if close (increased range and strength)
-    if (mRigidBodyComponent)
+    Vector2 toPlayer = player->GetPosition() - GetPosition();
+    float distance = toPlayer.Length();
+    if (distance < MAGNET_RADIUS && distance > 5.0f)
     {
-        Vector2 toPlayer = player->GetPosition() - GetPosition();
-        float distance = toPlayer.Length();
-        if (distance < 250.0f && distance > 5.0f)  // Increased range for better collection
-        {
-            toPlayer.Normalize();
-            float pullStrength = (250.0f - distance) / 250.0f;  // Stronger when closer
-            Vector2 pullForce = toPlayer * pullStrength * 800.0f * deltaTime;  // Much stronger pull (was 500.0f)
-            mRigidBodyComponent->SetVelocity(mRigidBodyComponent->GetVelocity() + pullForce);
-            
-            // Clamp max speed - increased for snappier collection
-            Vector2 vel = mRigidBodyComponent->GetVelocity();
-            if (vel.Length() > 450.0f)  // Higher max speed for faster collection (was 300.0f)
-            {
-                vel.Normalize();
-                mRigidBodyComponent->SetVelocity(vel * 450.0f);
-            }
-        }
-        
-        // Friction to slow down over time
+        toPlayer.Normalize();
+        float pullStrength = (MAGNET_RADIUS - distance) / MAGNET_RADIUS;  // Stronger when closer
+        Vector2 pullForce = toPlayer * pullStrength * 800.0f * deltaTime;  // Much stronger pull (was 500.0f)
+        mRigidBodyComponent->SetVelocity(mRigidBodyComponent->GetVelocity() + pullForce);
+
+        // Clamp max speed - increased for snappier collection
         Vector2 vel = mRigidBodyComponent->GetVelocity();
-        vel *= (1.0f - deltaTime * 2.0f);  // Decay velocity
-        if (vel.Length() < 5.0f)
+        if (vel.Length() > 450.0f)  // Higher max speed for faster collection (was 300.0f)
         {
-            vel = Vector2::Zero;
+            vel.Normalize();
+            mRigidBodyComponent->SetVelocity(vel * 450.0f);
         }
-        mRigidBodyComponent->SetVelocity(vel);
     }
 }
-
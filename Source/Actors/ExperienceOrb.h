@@ -8,6 +8,11 @@ public:
     ~ExperienceOrb();
 
     void OnUpdate(float deltaTime) override;
+
+    // Called by the player for orbs found near it in the orb grid
+    void UpdatePickup(class Player* player, float deltaTime);
+
+    static constexpr float MAGNET_RADIUS = 250.0f;
     
     float GetExperienceValue() const { return mExperienceValue; }
     bool IsCollected() const { return mCollected; }
@@ -2,10 +2,10 @@
 #include "../Game.h"
 #include "../Random.h"
 #include "Enemy.h"
+#include "ExperienceOrb.h"
 #include "../Components/CircleColliderComponent.h"
 #include "../Components/RigidBodyComponent.h"
 #include "../Components/AnimatorComponent.h"
-#include "../Components/ParticleSystemComponent.h"
 #include "../Math.h"
 #include <algorithm>
 
@@ -17,6 +17,7 @@ Player::Player(class Game* game)
     : Actor(game)
     , mHealth(150.0f)  // Increased starting health for better survivability
     , mMaxHealth(150.0f)
+    , mIsInvulnerable(false)
     , mMoveSpeed(420.0f)  // Faster base movement for better feel
     , mAttackCooldown(0.0f)
     , mDamageMultiplier(1.0f)
@@ -49,6 +50,8 @@ Player::Player(class Game* game)
     , mPendingUpgrades(0)
     , mCurrentDirection(PlayerDirection::Front)
 {
+    mType = ActorType::Player;
+
     SetPosition(Vector2(Game::WORLD_WIDTH / 2.0f, Game::WORLD_HEIGHT / 2.0f));
     SetScale(Vector2(1.0f, -1.0f)); // Flip Y to fix upside-down sprite
     
@@ -256,19 +259,32 @@ void Player::OnUpdate(float deltaTime)
     }
     
     // Dano por contato com inimigos - reduced damage for better balance
-    for (auto enemy : GetGame()->GetEnemies())
+    if (mCircleColliderComponent)
     {
-        if (enemy && enemy->GetState() == ActorState::Active && mCircleColliderComponent)
+        bool touchingEnemy = false;
+        GetGame()->GetEnemyGrid().ForEachNear(GetPosition(), mCircleColliderComponent->GetRadius(), [&](Enemy* enemy)
         {
-            auto* enemyCollider = enemy->GetComponent<CircleColliderComponent>();
+            if (touchingEnemy || enemy->GetState() != ActorState::Active) return;
+
+            auto* enemyCollider = enemy->GetCollider();
             if (enemyCollider && mCircleColliderComponent->Intersect(*enemyCollider))
             {
-                TakeDamage(6.0f * deltaTime);  // Reduced for better survivability
-                GetGame()->AddScreenShake(5.0f, 0.15f);  // Better feedback
-                break;
+                touchingEnemy = true;
             }
+        });
+
+        if (touchingEnemy)
+        {
+            TakeDamage(6.0f * deltaTime);  // Reduced for better survivability
+            GetGame()->AddScreenShake(5.0f, 0.15f);  // Better feedback
         }
     }
+
+    // Orbs de XP próximas: ímã e coleta
+    GetGame()->GetOrbGrid().ForEachNear(GetPosition(), ExperienceOrb::MAGNET_RADIUS, [&](ExperienceOrb* orb)
+    {
+        orb->UpdatePickup(this, deltaTime);
+    });
     
     // Death check
     if (mHealth <= 0.0f)
@@ -291,6 +307,11 @@ void Player::OnUpdate(float deltaTime)
 
 void Player::TakeDamage(float damage)
 {
+    if (mIsInvulnerable)
+    {
+        return;
+    }
+
     mHealth -= damage;
     if (mHealth < 0.0f) mHealth = 0.0f;
     
@@ -16,12 +16,16 @@ public:
 
     void OnProcessInput(const Uint8* keyState) override;
     void OnUpdate(float deltaTime) override;
+
+    class CircleColliderComponent* GetCollider() const { return mCircleColliderComponent; }
     
     // Health system
     float GetHealth() const { return mHealth; }
     float GetMaxHealth() const { return mMaxHealth; }
     void TakeDamage(float damage);
     void Heal(float amount);
+    // Ignores all damage (used by the benchmark so runs always last)
+    void SetInvulnerable(bool invulnerable) { mIsInvulnerable = invulnerable; }
     void IncreaseMaxHealth(float amount) { mMaxHealth += amount; mHealth += amount; }
     
     // Upgrade system
@@ -71,6 +75,7 @@ private:
     
     float mHealth;
     float mMaxHealth;
+    bool mIsInvulnerable;
     float mMoveSpeed;
     float mAttackCooldown;
     
@@ -0,0 +1,185 @@
+//
+// Headless benchmark: runs named scenarios on the Game simulation for a
+// fixed number of ticks with a fixed seed and reports step-time percentiles
+// plus the time spent in each simulation stage.
+//
+// Usage: vampire-survivors-bench [--scenario <name>] [--ticks <n>] [--seed <n>] [--tick-rate <hz>]
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <SDL.h>
+#include "../Game.h"
+#include "../Random.h"
+#include "../Actors/Player.h"
+
+namespace
+{
+    struct Scenario
+    {
+        const char* name;
+        const char* description;
+        void (*setup)(Game& game);
+    };
+
+    const Scenario SCENARIOS[] = {
+        { "start", "New game, regular spawns", [](Game&) {} },
+        { "horde", "1000 Comum + 50 Atirador around player", [](Game& game)
+            {
+                game.SpawnEnemyOfKind(EnemyKind::Comum, 1000);
+                game.SpawnEnemyOfKind(EnemyKind::Atirador, 50);
+            } },
+        { "mixed", "250 of each enemy kind around player", [](Game& game)
+            {
+                game.SpawnEnemyOfKind(EnemyKind::Comum, 250);
+                game.SpawnEnemyOfKind(EnemyKind::Corredor, 250);
+                game.SpawnEnemyOfKind(EnemyKind::GordoExplosivo, 250);
+                game.SpawnEnemyOfKind(EnemyKind::Atirador, 250);
+            } },
+        { "wave8-bosses", "Wave 8 crowd with both bosses", [](Game& game)
+            {
+                // Regular spawns stop while a boss is alive, so start with the crowd
+                game.JumpToWave(8);
+                game.SpawnEnemyOfKind(EnemyKind::Comum, 200);
+                game.SpawnEnemyOfKind(EnemyKind::Corredor, 100);
+                game.SpawnEnemyOfKind(EnemyKind::GordoExplosivo, 50);
+                game.SpawnEnemyOfKind(EnemyKind::Atirador, 50);
+                game.SpawnBoss(3);
+                game.SpawnBoss(6);
+            } },
+    };
+
+    double ToMs(Uint64 ticks)
+    {
+        return 1000.0 * static_cast<double>(ticks) / static_cast<double>(SDL_GetPerformanceFrequency());
+    }
+
+    // Nearest-rank percentile of an ascending list
+    double Percentile(const std::vector<double>& sorted, double p)
+    {
+        size_t rank = static_cast<size_t>(p / 100.0 * static_cast<double>(sorted.size()) + 0.5);
+        rank = std::min(std::max<size_t>(rank, 1), sorted.size());
+        return sorted[rank - 1];
+    }
+
+    void RunScenario(Game& game, const Scenario& scenario, int ticks, unsigned int seed)
+    {
+        Random::Seed(seed);
+        game.StartNewGame();
+        game.GetPlayer()->SetInvulnerable(true);
+        scenario.setup(game);
+        game.GetProfiler().Reset();
+
+        std::vector<double> stepMs;
+        stepMs.reserve(ticks);
+        size_t maxEnemies = 0;
+
+        for (int i = 0; i < ticks; ++i)
+        {
+            Uint64 start = SDL_GetPerformanceCounter();
+            if (!game.StepHeadless())
+            {
+                break;
+            }
+            stepMs.emplace_back(ToMs(SDL_GetPerformanceCounter() - start));
+            maxEnemies = std::max(maxEnemies, game.GetEnemies().size());
+        }
+
+        if (stepMs.empty())
+        {
+            printf("%-14s no steps ran\n", scenario.name);
+            return;
+        }
+
+        double total = 0.0;
+        for (double ms : stepMs)
+        {
+            total += ms;
+        }
+        std::vector<double> sorted = stepMs;
+        std::sort(sorted.begin(), sorted.end());
+
+        printf("%-14s %s\n", scenario.name, scenario.description);
+        printf("  ticks %zu  max enemies %zu  mean %.3f ms  p50 %.3f  p95 %.3f  p99 %.3f  max %.3f ms\n",
+               stepMs.size(), maxEnemies, total / stepMs.size(), Percentile(sorted, 50.0),
+               Percentile(sorted, 95.0), Percentile(sorted, 99.0), sorted.back());
+
+        printf("  per tick:");
+        const Profiler& profiler = game.GetProfiler();
+        for (int s = 0; s < Profiler::NUM_SECTIONS; ++s)
+        {
+            auto section = static_cast<ProfileSection>(s);
+            double ms = 1000.0 * profiler.GetSeconds(section) / stepMs.size();
+            printf("  %s %.3f", Profiler::GetName(section), ms);
+        }
+        printf(" ms\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const char* only = nullptr;
+    int ticks = 1800;
+    unsigned int seed = 1234;
+    int tickRate = Game::DEFAULT_TICK_RATE;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--scenario") == 0 && i + 1 < argc)
+        {
+            only = argv[++i];
+        }
+        else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc)
+        {
+            ticks = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+        {
+            seed = static_cast<unsigned int>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (strcmp(argv[i], "--tick-rate") == 0 && i + 1 < argc)
+        {
+            tickRate = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--list") == 0)
+        {
+            for (const auto& scenario : SCENARIOS)
+            {
+                printf("%-14s %s\n", scenario.name, scenario.description);
+            }
+            return 0;
+        }
+    }
+
+    Game game;
+    game.SetHeadless(true);
+    game.SetTickRate(tickRate);
+    if (!game.Initialize())
+    {
+        return 1;
+    }
+
+    printf("seed %u, %d ticks at %d Hz\n", seed, ticks, tickRate);
+
+    bool ran = false;
+    for (const auto& scenario : SCENARIOS)
+    {
+        if (only && strcmp(only, scenario.name) != 0)
+        {
+            continue;
+        }
+        RunScenario(game, scenario, ticks, seed);
+        ran = true;
+    }
+
+    if (!ran)
+    {
+        printf("Unknown scenario '%s' (use --list)\n", only);
+    }
+
+    game.Shutdown();
+    return ran ? 0 : 1;
+}
@@ -12,12 +12,23 @@
 AnimatorComponent::AnimatorComponent(class Actor *owner, const std::string &texPath, const std::string &dataPath,
                                      int width, int height, int drawOrder)
     : DrawComponent(owner, drawOrder)
+      , mSpriteTexture(nullptr)
+      , mAtlasRegion(Vector4::UnitRect)
       , mAnimTimer(0.0f)
       , mIsPaused(false)
       , mWidth(width)
       , mHeight(height)
       , mTextureFactor(1.0f) {
-    mSpriteTexture = owner->GetGame()->GetRenderer()->GetTexture(texPath);
+    // Headless: no texture, so Draw does nothing; animation data still loads
+    if (Renderer *renderer = owner->GetGame()->GetRenderer()) {
+        // Prefer the shared atlas page; frame rects are remapped into it below
+        if (const auto *region = renderer->GetAtlasRegion(texPath)) {
+            mSpriteTexture = region->texture;
+            mAtlasRegion = region->rect;
+        } else {
+            mSpriteTexture = renderer->GetTexture(texPath);
+        }
+    }
 
     LoadSpriteSheetData(dataPath);
 }
@@ -52,44 +63,66 @@ bool AnimatorComponent::LoadSpriteSheetData(const std::string &dataPath) {
         int w = frame["frame"]["w"].get<int>();
         int h = frame["frame"]["h"].get<int>();
 
-        mSpriteSheetData.emplace_back(static_cast<float>(x) / textureWidth, static_cast<float>(y) / textureHeight,
-                                      static_cast<float>(w) / textureWidth, static_cast<float>(h) / textureHeight);
+        // Sheet-space UVs scaled into the atlas region (identity without an atlas)
+        mSpriteSheetData.emplace_back(mAtlasRegion.x + static_cast<float>(x) / textureWidth * mAtlasRegion.z,
+                                      mAtlasRegion.y + static_cast<float>(y) / textureHeight * mAtlasRegion.w,
+                                      static_cast<float>(w) / textureWidth * mAtlasRegion.z,
+                                      static_cast<float>(h) / textureHeight * mAtlasRegion.w);
     }
 
     return true;
 }
 
-void AnimatorComponent::Draw(Renderer *renderer) {
-    if (!mIsVisible || !mSpriteTexture) return;
-
-    auto pos = mOwner->GetPosition();
-    auto scale = mOwner->GetScale();
-    float rotation = mOwner->GetRotation();
-    Vector2 size = Vector2(static_cast<float>(fabs(mWidth * scale.x)), static_cast<float>(fabs(mHeight * scale.y)));
-    size.x = static_cast<float>(mWidth) * (scale.x < 0.0f ? -scale.x : scale.x);
-    size.y = static_cast<float>(mHeight) * (scale.y < 0.0f ? -scale.y : scale.y);
-    Vector2 camera = mOwner->GetGame()->GetCameraPosition();
-
+Vector4 AnimatorComponent::GetFrameRect() const {
     Vector4 rect = Vector4::UnitRect;
-    bool flipH;
-    if (scale.x < 0.0f) flipH = true;
-    else flipH = false;
 
-    if (!mAnimName.empty() && !mAnimations[mAnimName].empty()) {
-        const auto &frames = mAnimations[mAnimName];
+    auto anim = mAnimations.find(mAnimName);
+    if (anim != mAnimations.end() && !anim->second.empty()) {
+        const auto &frames = anim->second;
         int currFrame = static_cast<int>(mAnimTimer) % frames.size();
         int spriteIdx = frames[currFrame];
         if (spriteIdx >= 0 && spriteIdx < mSpriteSheetData.size()) {
             rect = mSpriteSheetData[spriteIdx];
-            
-            if (scale.y < 0.0f) {
-                float temp = rect.y;
+
+            if (mOwner->GetScale().y < 0.0f) {
                 rect.y = rect.y + rect.w;
                 rect.w = -rect.w;
             }
         }
     }
-    renderer->DrawTexture(pos, size, rotation, mColor, mSpriteTexture, rect, camera, flipH, mTextureFactor);
+    return rect;
+}
+
+void AnimatorComponent::Draw(Renderer *renderer) {
+    if (!mIsVisible || !mSpriteTexture || mIsInstanced) return;
+
+    auto pos = mOwner->GetRenderPosition();
+    auto scale = mOwner->GetScale();
+    float rotation = mOwner->GetRotation();
+    Vector2 size;
+    size.x = static_cast<float>(mWidth) * (scale.x < 0.0f ? -scale.x : scale.x);
+    size.y = static_cast<float>(mHeight) * (scale.y < 0.0f ? -scale.y : scale.y);
+
+    bool flipH = scale.x < 0.0f;
+    renderer->DrawTexture(pos, size, rotation, mColor, mSpriteTexture, GetFrameRect(), flipH, mTextureFactor);
+}
+
+float AnimatorComponent::GetBoundingRadius() const {
+    return 0.5f * Math::Sqrt(static_cast<float>(mWidth * mWidth + mHeight * mHeight));
+}
+
+bool AnimatorComponent::GetInstance(SpriteInstance &instance) const {
+    if (!mIsVisible || !mSpriteTexture) return false;
+
+    auto scale = mOwner->GetScale();
+    instance.position = mOwner->GetRenderPosition();
+    // Negative width mirrors the quad, like the flip flag of DrawTexture
+    instance.size.x = static_cast<float>(mWidth) * scale.x;
+    instance.size.y = static_cast<float>(mHeight) * (scale.y < 0.0f ? -scale.y : scale.y);
+    instance.rotation = mOwner->GetRotation();
+    instance.textureRect = GetFrameRect();
+    instance.color = mColor;
+    return true;
 }
 
 void AnimatorComponent::Update(float deltaTime) {
@@ -19,6 +19,9 @@ public:
 
     void Update(float deltaTime) override;
 
+    // Half the diagonal of the sprite
+    float GetBoundingRadius() const override;
+
     // Use to change the FPS of the animation
     void SetAnimFPS(float fps) { mAnimFPS = fps; }
 
@@ -33,12 +36,26 @@ public:
     // Add an animation of the corresponding name to the animation map
     void AddAnimation(const std::string &name, const std::vector<int> &images);
 
+    // Instanced animators are skipped by Draw; their owner's system collects
+    // them with GetInstance and draws them all in one call per texture
+    void SetInstanced(bool instanced) { mIsInstanced = instanced; }
+    bool IsInstanced() const { return mIsInstanced; }
+    bool GetInstance(SpriteInstance &instance) const;
+
+    class Texture *GetTexture() const { return mSpriteTexture; }
+
 private:
     bool LoadSpriteSheetData(const std::string &dataPath);
 
+    // UV rect of the current frame (flipped vertically when scale.y < 0)
+    Vector4 GetFrameRect() const;
+
     // Sprite sheet texture
     class Texture *mSpriteTexture;
 
+    // Where the sheet sits inside mSpriteTexture (the whole texture unless atlased)
+    Vector4 mAtlasRegion;
+
     // Vector of sprites
     std::vector<Vector4> mSpriteSheetData;
 
@@ -57,6 +74,8 @@ private:
     // Whether or not the animation is paused (defaults to false)
     bool mIsPaused = false;
 
+    bool mIsInstanced = false;
+
     // Size
     int mWidth;
     int mHeight;
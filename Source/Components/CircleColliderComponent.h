@@ -3,7 +3,6 @@
 #pragma once
 #include "Component.h"
 #include "../Math.h"
-#include <vector>
 
 class CircleColliderComponent : public Component
 {
@@ -22,7 +21,8 @@ public:
     bool Intersect(const CircleColliderComponent& b) const;
 
 private:
+    static constexpr int NUM_DEBUG_POINTS = 10;
+
     float mRadius;
-    class VertexArray *mDrawArray;
 };
 
@@ -7,48 +7,48 @@
 DrawComponent::DrawComponent(class Actor* owner, std::vector<Vector2> &vertices, int drawOrder)
     :Component(owner)
     ,mDrawOrder(drawOrder)
+    ,mDrawIndex(-1)
     ,mIsVisible(true)
     ,mUseCamera(true)
     ,mUseFilled(false)
     ,mColor(1.0f, 1.0f, 1.0f)
+    ,mDrawArray(nullptr)
+    ,mBoundingRadius(0.0f)
 {
 
     mOwner->GetGame()->AddDrawable(this);
 
-    
-    std::vector<float> vertexArray;
     for (const auto& vertex : vertices)
     {
-        vertexArray.push_back(vertex.x);
-        vertexArray.push_back(vertex.y);
-        vertexArray.push_back(0.0f); // z coordinate (2D game)
+        mBoundingRadius = Math::Max(mBoundingRadius, vertex.Length());
     }
 
-   
-    std::vector<unsigned int> indices;
-    for (size_t i = 0; i < vertices.size(); i++)
+    // Sem contexto GL no modo headless
+    if (mOwner->GetGame()->IsHeadless())
     {
-        indices.push_back(static_cast<unsigned int>(i));
+        return;
     }
 
-    
-    mDrawArray = new VertexArray(vertexArray.data(), static_cast<unsigned int>(vertices.size()),
-                                 indices.data(), static_cast<unsigned int>(indices.size()));
+    // Drawn in order, so no index buffer
+    static_assert(sizeof(Vector2) == 2 * sizeof(float), "Vector2 must be two packed floats");
+    mDrawArray = new VertexArray(vertices.data(), static_cast<unsigned int>(vertices.size()),
+                                 VertexArray::Layout::Pos2);
 }
 
 DrawComponent::DrawComponent(class Actor *owner, int drawOrder)
         : Component(owner)
         , mDrawOrder(drawOrder)
+        , mDrawIndex(-1)
         , mIsVisible(true)
         , mUseCamera(true)
         , mUseFilled(false)
         , mColor(Vector3::One)
         , mDrawArray(nullptr)
+        , mBoundingRadius(0.0f)
 {
     mOwner->GetGame()->AddDrawable(this);
 }
 
-
 DrawComponent::~DrawComponent()
 {
     // Only try to remove if game is still valid
@@ -56,40 +56,45 @@ DrawComponent::~DrawComponent()
     {
         mOwner->GetGame()->RemoveDrawable(this);
     }
-    
-    delete mDrawArray;
-    mDrawArray = nullptr;
+
+    // A frame already recorded may still draw it
+    if (mDrawArray)
+    {
+        mOwner->GetGame()->GetRenderer()->Release(mDrawArray);
+        mDrawArray = nullptr;
+    }
+}
+
+bool DrawComponent::IsInView(const Vector2& viewMin, const Vector2& viewMax) const
+{
+    if (!mUseCamera)
+    {
+        return true;
+    }
+
+    const Vector2& scale = mOwner->GetScale();
+    float radius = GetBoundingRadius() * Math::Max(Math::Abs(scale.x), Math::Abs(scale.y));
+    Vector2 position = mOwner->GetRenderPosition();
+
+    return position.x + radius >= viewMin.x && position.x - radius <= viewMax.x &&
+           position.y + radius >= viewMin.y && position.y - radius <= viewMax.y;
 }
 
 void DrawComponent::Draw(class Renderer *renderer)
 {
     if (mIsVisible && mDrawArray)
     {
-        Matrix4 modelMatrix = mOwner->GetModelMatrix();
-        
-        // Apply camera offset only if enabled and game is playing
-        if (mUseCamera && mOwner->GetGame()->GetState() == MenuState::Playing)
-        {
-            // Get camera offset from game
-            Vector2 cameraPos = mOwner->GetGame()->GetCameraPosition();
-            Vector2 screenCenter(static_cast<float>(Game::WINDOW_WIDTH) / 2.0f, static_cast<float>(Game::WINDOW_HEIGHT) / 2.0f);
-            
-            // Calculate offset to center camera on screen
-            Vector2 cameraOffset = screenCenter - cameraPos;
-            
-            // Apply camera offset to model matrix
-            Matrix4 cameraTransform = Matrix4::CreateTranslation(Vector3(cameraOffset.x, cameraOffset.y, 0.0f));
-            modelMatrix = cameraTransform * modelMatrix;
-        }
-        
+        // Only the model; the renderer applies the camera of the frame
+        Matrix4 modelMatrix = mOwner->GetRenderModelMatrix();
+
         // Use filled rendering if enabled, otherwise use line rendering
         if (mUseFilled)
         {
-            renderer->DrawFilled(modelMatrix, mDrawArray, mColor);
+            renderer->DrawFilled(modelMatrix, mDrawArray, mColor, !mUseCamera);
         }
         else
         {
-            renderer->Draw(modelMatrix, mDrawArray, mColor);
+            renderer->Draw(modelMatrix, mDrawArray, mColor, !mUseCamera);
         }
     }
 }
@@ -18,6 +18,16 @@ public:
     virtual void Draw(Renderer* renderer);
     int GetDrawOrder() const { return mDrawOrder; }
 
+    // Position inside Game's layer for this draw order (-1 when not added)
+    void SetDrawIndex(int index) { mDrawIndex = index; }
+    int GetDrawIndex() const { return mDrawIndex; }
+
+    // Largest distance from the owner's position to anything drawn, at scale 1
+    virtual float GetBoundingRadius() const { return mBoundingRadius; }
+    // False when the drawing is surely outside the world-space view rectangle.
+    // Screen-space drawables are always in view.
+    bool IsInView(const Vector2& viewMin, const Vector2& viewMax) const;
+
     void SetVisible(bool visible) { mIsVisible = visible; }
     void SetColor(const Vector3& color) { mColor = color; }
     const Vector3& GetColor() const { return mColor; }
@@ -26,9 +36,11 @@ public:
 
 protected:
     int mDrawOrder;
+    int mDrawIndex;
     bool mIsVisible;
     bool mUseCamera;
     bool mUseFilled;
     Vector3 mColor;
     class VertexArray *mDrawArray;
+    float mBoundingRadius;
 };
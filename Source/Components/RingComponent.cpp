@@ -0,0 +1,51 @@
+#include "RingComponent.h"
+#include "../Game.h"
+#include "../Actors/Actor.h"
+
+RingComponent::RingComponent(class Actor* owner, float radius, const Vector3& color, float thickness, int drawOrder)
+    : DrawComponent(owner, drawOrder)
+    , mRadius(radius)
+    , mThickness(thickness)
+    , mFill(0.0f)
+    , mAlpha(1.0f)
+    , mFadeRate(0.0f)
+{
+    mColor = color;
+}
+
+void RingComponent::FadeOut(float duration)
+{
+    if (duration <= 0.0f)
+    {
+        mAlpha = 0.0f;
+        mFadeRate = 0.0f;
+        return;
+    }
+    mFadeRate = mAlpha / duration;
+}
+
+void RingComponent::Update(float deltaTime)
+{
+    if (mFadeRate > 0.0f)
+    {
+        mAlpha = Math::Max(mAlpha - mFadeRate * deltaTime, 0.0f);
+    }
+}
+
+void RingComponent::Draw(Renderer* renderer)
+{
+    if (!mIsVisible || mAlpha <= 0.0f)
+    {
+        return;
+    }
+
+    const Vector2& scale = mOwner->GetScale();
+    RingInstance ring;
+    ring.center = mOwner->GetRenderPosition();
+    ring.radius = mRadius * Math::Max(Math::Abs(scale.x), Math::Abs(scale.y));
+    ring.thickness = mThickness;
+    ring.color = mColor;
+    ring.fill = mFill;
+    ring.alpha = mAlpha;
+    renderer->DrawRing(ring, !mUseCamera);
+}
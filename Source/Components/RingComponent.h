@@ -0,0 +1,34 @@
+#pragma once
+#include "DrawComponent.h"
+
+// Circle outline (optionally filled) around the owner, drawn analytically by
+// the ring shader: crisp at any radius and batched with every other ring.
+// Rings default to their own layer under the actors (draw order 100), so
+// telegraph fills never cover them and a frame's rings stay together.
+class RingComponent : public DrawComponent
+{
+public:
+    static constexpr int RING_DRAW_ORDER = 90;
+
+    RingComponent(class Actor* owner, float radius, const Vector3& color, float thickness = 2.0f,
+                  int drawOrder = RING_DRAW_ORDER);
+
+    void Draw(Renderer* renderer) override;
+    void Update(float deltaTime) override;
+
+    float GetBoundingRadius() const override { return mRadius + mThickness; }
+
+    void SetRadius(float radius) { mRadius = radius; }
+    // Opacity of the inside of the circle (0: outline only)
+    void SetFill(float fill) { mFill = fill; }
+    void SetAlpha(float alpha) { mAlpha = alpha; }
+    // Fades alpha to zero over duration seconds, starting now
+    void FadeOut(float duration);
+
+private:
+    float mRadius;
+    float mThickness;
+    float mFill;
+    float mAlpha;
+    float mFadeRate;
+};
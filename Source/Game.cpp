@@ -10,7 +10,6 @@
 #include "Game.h"
 #include "Actors/Player.h"
 #include "Actors/Enemy.h"
-#include "Actors/Projectile.h"
 #include "Actors/Boss.h" // <-- INCLUÍDO O CHEFE
 #include "Actors/ExperienceOrb.h"
 #include "Actors/FloatingText.h"
@@ -19,10 +18,11 @@
 #include "Menus/PauseMenu.h"
 #include "Menus/UpgradeMenu.h"
 #include "Components/DrawComponent.h"
+#include "Components/RingComponent.h"
 #include "Components/RigidBodyComponent.h"
 #include "Components/CircleColliderComponent.h"
-#include "Renderer/VertexArray.h"
 #include "Renderer/TextRenderer.h"
+#include "Renderer/UIDrawList.h"
 #include "Renderer/Renderer.h"
 #include "Random.h"
 #include "Math.h"
@@ -32,12 +32,40 @@
 const float Game::COMBO_TIMEOUT = 3.0f;
 const float Game::MAX_COMBO_MULTIPLIER = 5.0f;
 
+namespace
+{
+    // O(1) removal from a typed actor list: each actor stores its own index,
+    // the last element is moved into the hole and its index is patched.
+    // Removing an actor that isn't in the list (index -1 or stale) does nothing.
+    template <typename T, typename U>
+    void SwapPopRemove(std::vector<T*>& list, T* item, int (U::*getIndex)() const, void (U::*setIndex)(int))
+    {
+        int index = (item->*getIndex)();
+        if (index < 0 || index >= static_cast<int>(list.size()) || list[index] != item)
+        {
+            return;
+        }
+
+        T* last = list.back();
+        list[index] = last;
+        (last->*setIndex)(index);
+        list.pop_back();
+
+        (item->*setIndex)(-1);
+    }
+}
+
 Game::Game()
         : mWindow(nullptr)
         , mRenderer(nullptr)
         , mAudioSystem(nullptr)
-        , mTicksCount(0)
+        , mLastCounter(0)
+        , mAccumulator(0.0)
+        , mFixedDeltaTime(1.0f / DEFAULT_TICK_RATE)
+        , mRenderAlpha(0.0f)
         , mIsRunning(true)
+        , mIsHeadless(false)
+        , mUseRenderThread(true)
         , mIsDebugging(false)
         , mUpdatingActors(false)
         , mGameState(MenuState::MainMenu)
@@ -45,6 +73,8 @@ Game::Game()
         , mPauseMenu(nullptr)
         , mUpgradeMenu(nullptr)
         , mPlayer(nullptr)
+        , mEnemyGrid(static_cast<float>(WORLD_WIDTH), static_cast<float>(WORLD_HEIGHT), GRID_CELL_SIZE)
+        , mOrbGrid(static_cast<float>(WORLD_WIDTH), static_cast<float>(WORLD_HEIGHT), GRID_CELL_SIZE)
         , mBackground(nullptr)
         , mCurrentWave(1)
         , mWaveTimer(0.0f)
@@ -55,6 +85,7 @@ Game::Game()
         , mBoss5Spawned(false) // (Não mais usado pela nova lógica)
         , mBoss10Spawned(false) // (Não mais usado pela nova lógica)
         , mCameraPosition(Vector2::Zero)
+        , mPrevCameraPosition(Vector2::Zero)
         , mScreenShakeAmount(0.0f)
         , mScreenShakeDuration(0.0f)
         , mLastBossWaveSpawned(0) // <-- ADICIONADO PARA O CHEFE
@@ -70,41 +101,67 @@ bool Game::Initialize()
 {
     Random::Init();
 
-    if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) != 0)
+    Uint32 subsystems = mIsHeadless ? 0 : (SDL_INIT_VIDEO | SDL_INIT_AUDIO);
+    if (SDL_Init(subsystems) != 0)
     {
         SDL_Log("Unable to initialize SDL: %s", SDL_GetError());
         return false;
     }
 
-    mAudioSystem = new AudioSystem();
-    if (!mAudioSystem->Initialize())
+    if (!mIsHeadless)
     {
-        SDL_Log("Failed to initialize audio system");
-        return false;
-    }
+        mAudioSystem = new AudioSystem();
+        if (!mAudioSystem->Initialize())
+        {
+            SDL_Log("Failed to initialize audio system");
+            return false;
+        }
 
-    mWindow = SDL_CreateWindow("Foge, Sô!", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, WINDOW_WIDTH, WINDOW_HEIGHT, SDL_WINDOW_OPENGL);
-    if (!mWindow)
-    {
-        SDL_Log("Failed to create window: %s", SDL_GetError());
-        return false;
-    }
+        mWindow = SDL_CreateWindow("Foge, Sô!", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, WINDOW_WIDTH, WINDOW_HEIGHT, SDL_WINDOW_OPENGL);
+        if (!mWindow)
+        {
+            SDL_Log("Failed to create window: %s", SDL_GetError());
+            return false;
+        }
 
-    mRenderer = new Renderer(mWindow);
-    mRenderer->Initialize(WINDOW_WIDTH, WINDOW_HEIGHT);
+        mRenderer = new Renderer(mWindow);
+        mRenderer->Initialize(WINDOW_WIDTH, WINDOW_HEIGHT);
 
-    // Initialize text renderer
-    TextRenderer::Initialize();
+        // Folhas de sprite num atlas só; o fundo é desenhado sozinho
+        mRenderer->LoadSpriteAtlas("../Assets/Sprites", {"Background"});
+
+        const std::string shotPath = "../Assets/Sprites/Shot/Shot.png";
+        if (const auto* shot = mRenderer->GetAtlasRegion(shotPath))
+        {
+            mProjectileSystem.SetTexture(shot->texture, shot->rect);
+        }
+        else
+        {
+            mProjectileSystem.SetTexture(mRenderer->GetTexture(shotPath), Vector4::UnitRect);
+        }
+
+        // Initialize text renderer
+        TextRenderer::Initialize();
+    }
 
     // Initialize menus
     mMainMenu  = new MainMenu(this);
     mPauseMenu = new PauseMenu(this);
     mUpgradeMenu = new UpgradeMenu(this);
 
-    mAudioSystem->LoadMusic("menu", "Assets/Music/twd_theme.mp3");
-    mAudioSystem->LoadMusic("gameplay", "Assets/Music/gameplay_music.mp3");
+    if (mAudioSystem)
+    {
+        mAudioSystem->LoadMusic("menu", "Assets/Music/twd_theme.mp3");
+        mAudioSystem->LoadMusic("gameplay", "Assets/Music/gameplay_music.mp3");
+    }
 
-    mTicksCount = SDL_GetTicks();
+    // Drawing overlaps the next simulation step from here on
+    if (mRenderer && mUseRenderThread && !mRenderer->StartRenderThread())
+    {
+        SDL_Log("Render thread unavailable, drawing on the main thread");
+    }
+
+    mLastCounter = SDL_GetPerformanceCounter();
 
     return true;
 }
@@ -116,6 +173,17 @@ void Game::InitializeActors()
     mPlayer = new Player(this);
     mPlayer->SetPosition(Vector2(static_cast<float>(WORLD_WIDTH) / 2.0f, static_cast<float>(WORLD_HEIGHT) / 2.0f));
     mCameraPosition = Vector2(static_cast<float>(WORLD_WIDTH) / 2.0f, static_cast<float>(WORLD_HEIGHT) / 2.0f);
+    mPrevCameraPosition = mCameraPosition;
+}
+
+void Game::SetTickRate(int ticksPerSecond)
+{
+    if (ticksPerSecond <= 0)
+    {
+        SDL_Log("Invalid tick rate %d, keeping %.0f Hz", ticksPerSecond, 1.0f / mFixedDeltaTime);
+        return;
+    }
+    mFixedDeltaTime = 1.0f / static_cast<float>(ticksPerSecond);
 }
 
 void Game::RunLoop()
@@ -125,6 +193,68 @@ void Game::RunLoop()
         ProcessInput();
         UpdateGame();
         GenerateOutput();
+        WaitForNextTick();
+    }
+}
+
+void Game::RunHeadless(float seconds)
+{
+    StartNewGame();
+
+    int ticks = static_cast<int>(seconds / mFixedDeltaTime);
+    int ticksRun = 0;
+    Uint64 start = SDL_GetPerformanceCounter();
+
+    while (ticksRun < ticks && mIsRunning && StepHeadless())
+    {
+        ticksRun++;
+    }
+
+    double wallSeconds = static_cast<double>(SDL_GetPerformanceCounter() - start) /
+                         static_cast<double>(SDL_GetPerformanceFrequency());
+    SDL_Log("Headless: %d ticks (%.1f s simulated) in %.3f s, wave %d, kills %d, enemies %zu%s",
+            ticksRun, ticksRun * mFixedDeltaTime, wallSeconds, mCurrentWave, mKills, mEnemySystem.Size(),
+            mGameState == MenuState::GameOver ? ", game over" : "");
+}
+
+bool Game::StepHeadless()
+{
+    // Sem jogador para escolher: pega um upgrade aleatório
+    if (mGameState == MenuState::UpgradeMenu)
+    {
+        int numUpgrades = mUpgradeMenu->GetNumUpgrades();
+        if (numUpgrades > 0)
+        {
+            mUpgradeMenu->ChooseUpgrade(Random::GetIntRange(0, numUpgrades - 1));
+        }
+        else
+        {
+            ResumeGame();
+        }
+    }
+    if (mGameState != MenuState::Playing)
+    {
+        return false;
+    }
+
+    StepSimulation(mFixedDeltaTime);
+    return true;
+}
+
+void Game::JumpToWave(int wave)
+{
+    // Same clock UpdateWaveSystem uses: one wave every 30 s
+    mCurrentWave = wave;
+    mWaveTimer = (wave - 1) * 30.0f;
+    mElapsedSeconds = mWaveTimer;
+    mLastBossWaveSpawned = wave;
+
+    for (auto& horde : mTimedHordes)
+    {
+        if (horde.atTime < mElapsedSeconds)
+        {
+            horde.fired = true;
+        }
     }
 }
 
@@ -189,29 +319,50 @@ void Game::ProcessInput()
             }
         }
 
-        for (auto actor : mActors)
+        mActorRegistry.BeginIteration();
+        for (size_t i = 0; i < mActorRegistry.Size(); ++i)
         {
-            actor->ProcessInput(state);
+            if (Actor* actor = mActorRegistry.At(i))
+            {
+                actor->ProcessInput(state);
+            }
         }
+        mActorRegistry.EndIteration();
     }
 }
 
 void Game::UpdateGame()
 {
-    while (!SDL_TICKS_PASSED(SDL_GetTicks(), mTicksCount + 16));
+    Uint64 now = SDL_GetPerformanceCounter();
+    double frameTime = static_cast<double>(now - mLastCounter) / static_cast<double>(SDL_GetPerformanceFrequency());
+    mLastCounter = now;
+
+    // Depois de um travamento (ex.: arrastar a janela) não tenta recuperar tudo
+    if (frameTime > MAX_FRAME_TIME)
+    {
+        frameTime = MAX_FRAME_TIME;
+    }
 
-    float deltaTime = (SDL_GetTicks() - mTicksCount) / 1000.0f;
-    if (deltaTime > 0.05f)
+    mAccumulator += frameTime;
+    while (mAccumulator >= mFixedDeltaTime)
     {
-        deltaTime = 0.05f;
+        SaveRenderState();
+        StepSimulation(mFixedDeltaTime);
+        mAccumulator -= mFixedDeltaTime;
     }
 
-    mTicksCount = SDL_GetTicks();
+    mRenderAlpha = static_cast<float>(mAccumulator / mFixedDeltaTime);
+}
 
+void Game::StepSimulation(float deltaTime)
+{
     if (mGameState == MenuState::Playing)
     {
         UpdateActors(deltaTime);
-        UpdateWaveSystem(deltaTime);
+        {
+            ScopedProfile profile(mProfiler, ProfileSection::Waves);
+            UpdateWaveSystem(deltaTime);
+        }
         if (mPlayer && mPlayer->GetHealth() <= 0.0f)
         {
             GameOver();
@@ -240,6 +391,33 @@ void Game::UpdateGame()
     }
 }
 
+void Game::SaveRenderState()
+{
+    // Transforms at the start of the step, used to interpolate when drawing
+    mPrevCameraPosition = mCameraPosition;
+    for (size_t i = 0; i < mActorRegistry.Size(); ++i)
+    {
+        if (Actor* actor = mActorRegistry.At(i))
+        {
+            actor->SavePreviousPosition();
+        }
+    }
+}
+
+void Game::WaitForNextTick()
+{
+    // Sleep instead of spinning until the next step is due. SDL_Delay has
+    // millisecond granularity; oversleeping just leaves more time in the
+    // accumulator for the next frame
+    double elapsed = static_cast<double>(SDL_GetPerformanceCounter() - mLastCounter) /
+                     static_cast<double>(SDL_GetPerformanceFrequency());
+    double remaining = mFixedDeltaTime - (mAccumulator + elapsed);
+    if (remaining > 0.0)
+    {
+        SDL_Delay(static_cast<Uint32>(remaining * 1000.0) + 1);
+    }
+}
+
 void Game::UpdateActors(float deltaTime)
 {
     // Don't update actors if we're not in Playing state
@@ -248,12 +426,6 @@ void Game::UpdateActors(float deltaTime)
         return;
     }
 
-    // Cap deltaTime to prevent huge jumps that could cause issues
-    if (deltaTime > 0.033f)  // Cap at ~30 FPS minimum
-    {
-        deltaTime = 0.033f;
-    }
-
     // Update combo system
     if (mComboTimer > 0.0f)
     {
@@ -271,13 +443,33 @@ void Game::UpdateActors(float deltaTime)
         }
     }
 
-    mUpdatingActors = true;
+    // Enemy chase/movement first, so the grids see this frame's positions
+    {
+        ScopedProfile profile(mProfiler, ProfileSection::Enemies);
+        mEnemySystem.Update(deltaTime, mPlayer, this);
+    }
+    {
+        ScopedProfile profile(mProfiler, ProfileSection::Grids);
+        RebuildSpatialGrids(deltaTime);
+    }
+    {
+        ScopedProfile profile(mProfiler, ProfileSection::Projectiles);
+        mProjectileSystem.Update(deltaTime, this);
+    }
+    {
+        ScopedProfile profile(mProfiler, ProfileSection::Particles);
+        mParticleSystem.Update(deltaTime);
+    }
+
+    // Actor updates, deferred experience and deletion of dead actors
+    ScopedProfile actorsProfile(mProfiler, ProfileSection::Actors);
 
-    // Create a copy of actors to iterate over safely
-    // This prevents iterator invalidation if actors are added/removed during update
-    std::vector<Actor*> actorsCopy = mActors;
+    mUpdatingActors = true;
+    mActorRegistry.BeginIteration();
 
-    for (auto actor : actorsCopy)
+    // Actors added during the loop wait in the registry's pending queue and
+    // actors removed leave a null entry, so indices stay valid here
+    for (size_t i = 0; i < mActorRegistry.Size(); ++i)
     {
         // Check state again in case it changed during update
         if (mGameState != MenuState::Playing)
@@ -285,38 +477,17 @@ void Game::UpdateActors(float deltaTime)
             break;
         }
 
-        // Safety checks
-        if (!actor) continue;
-
-        // Check if actor is still in the main list (might have been removed)
-        auto it = std::find(mActors.begin(), mActors.end(), actor);
-        if (it == mActors.end())
-        {
-            continue;  // Actor was removed, skip it
-        }
-
-        // Don't update if already destroyed
-        if (actor->GetState() == ActorState::Destroy)
+        Actor* actor = mActorRegistry.At(i);
+        if (!actor || actor->GetState() == ActorState::Destroy)
         {
             continue;
         }
 
         actor->Update(deltaTime);
-
-        // Check state again after update - it might have changed
-        if (mGameState != MenuState::Playing)
-        {
-            break;
-        }
     }
 
     mUpdatingActors = false;
-
-    for (auto pending : mPendingActors)
-    {
-        mActors.emplace_back(pending);
-    }
-    mPendingActors.clear();
+    mActorRegistry.EndIteration();
 
     // Process deferred experience AFTER all updates are done
     // This prevents state changes during actor updates
@@ -330,88 +501,78 @@ void Game::UpdateActors(float deltaTime)
         mDeferredExperience.clear();
     }
 
-    // CRITICAL: Process dead actors immediately to prevent corruption
-    // Collect indices of actors to delete first, then delete them
-    // This avoids iterator invalidation and accessing corrupted memory
-    std::vector<size_t> indicesToDelete;
-    std::vector<Actor*> actorsToDelete;
-
-    // First pass: identify actors to delete
-    for (size_t i = 0; i < mActors.size(); ++i)
+    // Collect dead actors first, then unregister and delete them
+    std::vector<Actor*> deadActors;
+    for (size_t i = 0; i < mActorRegistry.Size(); ++i)
     {
-        Actor* actor = mActors[i];
-        if (!actor)
-        {
-            indicesToDelete.push_back(i);
-            continue;
-        }
-
-        // Check state - if destroyed, mark for deletion
-        // Simple approach: just check state directly
-        // If actor is corrupted, the crash will happen here, but at least we've isolated it
+        Actor* actor = mActorRegistry.At(i);
         if (actor->GetState() == ActorState::Destroy)
         {
-            indicesToDelete.push_back(i);
-            actorsToDelete.push_back(actor);
-
-            // Remove from experience orbs list if it's an ExperienceOrb (before deletion)
-            ExperienceOrb* orb = dynamic_cast<ExperienceOrb*>(actor);
-            if (orb)
-            {
-                RemoveExperienceOrb(orb);
-            }
+            deadActors.emplace_back(actor);
         }
     }
 
-    // Second pass: remove from mActors (iterate backwards to maintain indices)
-    for (int i = static_cast<int>(indicesToDelete.size()) - 1; i >= 0; --i)
+    for (auto actor : deadActors)
     {
-        size_t idx = indicesToDelete[i];
-        if (idx < mActors.size())
+        // Remove from experience orbs list if it's an ExperienceOrb (before deletion)
+        if (actor->GetType() == ActorType::ExperienceOrb)
         {
-            mActors.erase(mActors.begin() + idx);
+            RemoveExperienceOrb(static_cast<ExperienceOrb*>(actor));
         }
+
+        // The destructor calls RemoveActor again, which is a no-op on a stale handle
+        mActorRegistry.Remove(actor->GetHandle());
+        delete actor;
     }
 
-    // Third pass: delete the actors
-    // Their destructors will call RemoveActor, but since we've already removed them
-    // and mUpdatingActors is true, RemoveActor will safely return
-    for (auto actor : actorsToDelete)
+    CompactDrawables();
+}
+
+void Game::RebuildSpatialGrids(float deltaTime)
+{
+    // Items keep moving while the frame updates, so each one is inserted with
+    // its collider radius plus the farthest it can travel in this frame
+    float slack = static_cast<float>(RigidBodyComponent::MAX_VELOCITY) * deltaTime;
+
+    mEnemyGrid.Clear();
+    const auto& enemies = mEnemySystem.GetEnemies();
+    for (size_t i = 0; i < enemies.size(); ++i)
     {
-        if (actor)
-        {
-            delete actor;
-        }
+        int index = static_cast<int>(i);
+        mEnemyGrid.Insert(enemies[i], mEnemySystem.GetPosition(index), mEnemySystem.GetRadius(index) + slack);
     }
+    mEnemyGrid.Build();
+
+    mOrbGrid.Clear();
+    for (auto* orb : mExperienceOrbs)
+    {
+        if (orb->GetState() != ActorState::Active || orb->IsCollected()) continue;
+
+        mOrbGrid.Insert(orb, orb->GetPosition(), slack);
+    }
+    mOrbGrid.Build();
 }
 
-void Game::AddEnemy(Enemy* enemy)
+void Game::AddEnemy(Enemy* enemy, EnemyKind kind, float radius, float speed, float health)
 {
-    mEnemies.emplace_back(enemy);
+    mEnemySystem.Add(enemy, kind, radius, speed, health);
 }
 
 void Game::RemoveEnemy(Enemy* enemy)
 {
-    auto it = std::find(mEnemies.begin(), mEnemies.end(), enemy);
-    if (it != mEnemies.end())
-    {
-        mEnemies.erase(it);
-    }
+    mEnemySystem.Remove(enemy);
 }
 
 // --- FUNÇÕES DO CHEFE ADICIONADAS ---
 void Game::AddBoss(Boss* boss)
 {
+    boss->SetBossListIndex(static_cast<int>(mBosses.size()));
     mBosses.emplace_back(boss);
 }
 
 void Game::RemoveBoss(Boss* boss)
 {
-    auto it = std::find(mBosses.begin(), mBosses.end(), boss);
-    if (it != mBosses.end())
-    {
-        mBosses.erase(it);
-    }
+    SwapPopRemove(mBosses, boss, &Boss::GetBossListIndex, &Boss::SetBossListIndex);
 }
 
 void Game::SpawnBoss(int waveNumber)
@@ -447,20 +608,6 @@ void Game::SpawnBoss(int waveNumber)
 }
 // ------------------------------------
 
-void Game::AddProjectile(Projectile* projectile)
-{
-    mProjectiles.emplace_back(projectile);
-}
-
-void Game::RemoveProjectile(Projectile* projectile)
-{
-    auto it = std::find(mProjectiles.begin(), mProjectiles.end(), projectile);
-    if (it != mProjectiles.end())
-    {
-        mProjectiles.erase(it);
-    }
-}
-
 void Game::SpawnProjectile(const Vector2& position,
                            const Vector2& direction,
                            float speed,
@@ -470,7 +617,7 @@ void Game::SpawnProjectile(const Vector2& position,
                            bool homing,
                            bool explosive)
 {
-    Projectile* projectile = new Projectile(this, position, direction, speed, fromPlayer, damage, pierce, homing, explosive);
+    mProjectileSystem.Spawn(position, direction, speed, fromPlayer, damage, pierce, homing, explosive);
 }
 
 void Game::SpawnExperienceOrb(const Vector2& position, float experienceValue)
@@ -483,6 +630,7 @@ void Game::SpawnExperienceOrb(const Vector2& position, float experienceValue)
 
 void Game::AddExperienceOrb(ExperienceOrb* orb)
 {
+    orb->SetListIndex(static_cast<int>(mExperienceOrbs.size()));
     mExperienceOrbs.emplace_back(orb);
 }
 
@@ -490,20 +638,7 @@ void Game::RemoveExperienceOrb(ExperienceOrb* orb)
 {
     if (!orb) return;
 
-    // Safely remove from list using manual iteration to avoid any issues
-    // This is more defensive than erase-remove and handles edge cases better
-    for (auto it = mExperienceOrbs.begin(); it != mExperienceOrbs.end(); )
-    {
-        if (*it == orb)
-        {
-            it = mExperienceOrbs.erase(it);
-            return;  // Found and removed, exit immediately
-        }
-        else
-        {
-            ++it;
-        }
-    }
+    SwapPopRemove(mExperienceOrbs, orb, &Actor::GetListIndex, &Actor::SetListIndex);
 }
 
 void Game::AddDeferredExperience(const DeferredExperience& deferred)
@@ -547,8 +682,8 @@ void Game::StartNewGame()
 
 void Game::SpawnFloatingText(const Vector2& position, const std::string& text, const Vector3& color)
 {
-    FloatingText* floatingText = new FloatingText(this, position, text, color);
-    AddActor(floatingText);
+    // The Actor constructor already registers it
+    new FloatingText(this, position, text, color);
 }
 
 void Game::OnEnemyKilled(const Vector2& position)
@@ -639,10 +774,13 @@ void Game::QuitToMenu()
     {
         // If we're updating actors, defer cleanup
         // But clear the state references immediately
+        // (enemy simulation data stays until CleanupGame deletes the enemies)
         mPlayer = nullptr;
-        mEnemies.clear();
-        mProjectiles.clear();
+        mProjectileSystem.Clear();
+        mParticleSystem.Clear();
         mBosses.clear();
+        mEnemyGrid.Clear();
+        mOrbGrid.Clear();
     }
 
     if (mAudioSystem)
@@ -740,12 +878,7 @@ void Game::SpawnExplosionParticles(const Vector2& position, const Vector3& color
 void Game::CreateDeathParticles(const Vector2& position, const Vector3& color, int count)
 {
     // Create small particles for death effect with better visuals
-    std::vector<Vector2> particleVertices;
     float size = Random::GetFloatRange(2.0f, 4.0f);  // Slightly larger particles
-    particleVertices.emplace_back(Vector2(-size, -size));
-    particleVertices.emplace_back(Vector2(size, -size));
-    particleVertices.emplace_back(Vector2(size, size));
-    particleVertices.emplace_back(Vector2(-size, size));
 
     for (int i = 0; i < count; ++i)
     {
@@ -754,24 +887,14 @@ void Game::CreateDeathParticles(const Vector2& position, const Vector3& color, i
         Vector2 dir(Math::Cos(angle), Math::Sin(angle));
         Vector2 particlePos = position + dir * Random::GetFloatRange(0.0f, 8.0f);  // Better spread
 
-        Actor* particle = new Actor(this);
-        particle->SetPosition(particlePos);
-
-        DrawComponent* drawComp = new DrawComponent(particle, particleVertices);
         Vector3 particleColor = color;
         // More vibrant color variation
         particleColor.x = Math::Clamp(particleColor.x + Random::GetFloatRange(-0.3f, 0.3f), 0.0f, 1.0f);
         particleColor.y = Math::Clamp(particleColor.y + Random::GetFloatRange(-0.3f, 0.3f), 0.0f, 1.0f);
         particleColor.z = Math::Clamp(particleColor.z + Random::GetFloatRange(-0.3f, 0.3f), 0.0f, 1.0f);
-        drawComp->SetColor(particleColor);
-        drawComp->SetFilled(true);
-        drawComp->SetUseCamera(true);
-
-        RigidBodyComponent* rbComp = new RigidBodyComponent(particle, 0.1f);
-        rbComp->SetVelocity(dir * speed);
 
-        particle->SetState(ActorState::Active);
-        particle->SetLifetime(0.8f); // Longer lifetime for spectacular visibility
+        // Longer lifetime for spectacular visibility
+        mParticleSystem.Emit(particlePos, dir * speed, particleColor, size, 0.8f);
     }
 }
 
@@ -780,12 +903,7 @@ void Game::CreateDeathParticles(const Vector2& position, const Vector3& color, i
 void Game::SpawnFallingParticles(const Vector2& position, const Vector3& color)
 {
     // Cria partículas pequenas (quadrados)
-    std::vector<Vector2> particleVertices;
     float size = Random::GetFloatRange(1.5f, 3.0f);
-    particleVertices.emplace_back(Vector2(-size, -size));
-    particleVertices.emplace_back(Vector2(size, -size));
-    particleVertices.emplace_back(Vector2(size, size));
-    particleVertices.emplace_back(Vector2(-size, size));
 
     int count = 18; // More particles for spectacular visual feedback
 
@@ -800,23 +918,13 @@ void Game::SpawnFallingParticles(const Vector2& position, const Vector3& color)
 
         Vector2 particlePos = position + dir * Random::GetFloatRange(0.0f, 5.0f);
 
-        Actor* particle = new Actor(this);
-        particle->SetPosition(particlePos);
-
-        DrawComponent* drawComp = new DrawComponent(particle, particleVertices);
         // Variação de cor (tom de poeira/cinza)
         Vector3 particleColor = color;
         particleColor.x = Math::Clamp(particleColor.x + Random::GetFloatRange(-0.1f, 0.1f), 0.0f, 1.0f);
         particleColor.y = Math::Clamp(particleColor.y + Random::GetFloatRange(-0.1f, 0.1f), 0.0f, 1.0f);
         particleColor.z = Math::Clamp(particleColor.z + Random::GetFloatRange(-0.1f, 0.1f), 0.0f, 1.0f);
-        drawComp->SetColor(particleColor);
-        drawComp->SetFilled(true);
-        drawComp->SetUseCamera(true);
-
-        RigidBodyComponent* rbComp = new RigidBodyComponent(particle, 0.1f);
-        rbComp->SetVelocity(dir * speed);
 
-        particle->SetLifetime(0.5f); // Longer lifetime for spectacular visibility
+        mParticleSystem.Emit(particlePos, dir * speed, particleColor, size, 0.5f);
     }
 }
 
@@ -826,22 +934,9 @@ void Game::SpawnExplosionRing(const Vector2& position, float radius)
     Actor* ring = new Actor(this);
     ring->SetPosition(position);
 
-    // Vértices do círculo (baseado no Enemy.cpp)
-    std::vector<Vector2> vertices;
-    const int numVertices = 32; // Mais vértices para um círculo suave
-    for (int i = 0; i < numVertices; ++i)
-    {
-        float angle = (Math::TwoPi / numVertices) * i;
-        vertices.emplace_back(Vector2(Math::Cos(angle) * radius, Math::Sin(angle) * radius));
-    }
-    // Adiciona o primeiro vértice no final para fechar o loop
-    vertices.emplace_back(vertices[0]);
-
-
-    DrawComponent* drawComp = new DrawComponent(ring, vertices);
-    drawComp->SetColor(Vector3(1.0f, 0.5f, 0.2f)); // Laranja da explosão
-    drawComp->SetFilled(false); // Importante: desenha só a linha (o anel)
-    drawComp->SetUseCamera(true);
+    // Anel analítico (ring shader), some junto com o ator
+    auto* ringComp = new RingComponent(ring, radius, Vector3(1.0f, 0.5f, 0.2f)); // Laranja da explosão
+    ringComp->FadeOut(0.3f);
 
     ring->SetLifetime(0.3f); // <-- Tempo de vida adicionado
 }
@@ -942,6 +1037,9 @@ void Game::SpawnEnemyOfKind(EnemyKind kind, int count)
                 e->SetExperienceValue(15.0f + mCurrentWave * 0.8f);
                 e->SetRangedShooter(true, 1.8f);
                 break;
+
+            default:
+                break;
         }
 
         e->SetPosition(spawnPos);
@@ -977,7 +1075,7 @@ void Game::UpdateWaveSystem(float deltaTime)
 
     // Limite global de população - Spectacular Vampire Survivors intensity
     const int maxEnemies = 600 + (mCurrentWave * 50);  // Higher cap for epic battles
-    if ((int)mEnemies.size() >= maxEnemies) return;
+    if ((int)mEnemySystem.Size() >= maxEnemies) return;
 
     // --- PAUSA O SPAWN NORMAL SE UM CHEFE ESTIVER ATIVO (MODIFICADO) ---
     if (!mBosses.empty())
@@ -995,9 +1093,9 @@ void Game::UpdateWaveSystem(float deltaTime)
             mElapsedSeconds <= r.end)
         {
             mRuleTimers[i] += deltaTime;
-            while (mRuleTimers[i] >= r.every && (int)mEnemies.size() < maxEnemies)
+            while (mRuleTimers[i] >= r.every && (int)mEnemySystem.Size() < maxEnemies)
             {
-                int canSpawn = std::min(r.count, maxEnemies - (int)mEnemies.size());
+                int canSpawn = std::min(r.count, maxEnemies - (int)mEnemySystem.Size());
                 if (canSpawn > 0)
                     SpawnEnemyOfKind(r.kind, canSpawn);
 
@@ -1029,85 +1127,21 @@ void Game::DrawUI()
     if (!mPlayer)
         return;
 
+    UIDrawList* ui = mRenderer->GetUIDrawList();
+
     // Draw health bar
     float healthPercent = mPlayer->GetHealth() / mPlayer->GetMaxHealth();
-
-    auto createVA = [](const std::vector<Vector2>& vertices) -> VertexArray* {
-        std::vector<float> floatArray;
-        std::vector<unsigned int> indices;
-        for (size_t i = 0; i < vertices.size(); ++i)
-        {
-            floatArray.push_back(vertices[i].x);
-            floatArray.push_back(vertices[i].y);
-            floatArray.push_back(0.0f);
-            indices.push_back(static_cast<unsigned int>(i));
-        }
-        return new VertexArray(floatArray.data(), static_cast<unsigned int>(vertices.size()), indices.data(), static_cast<unsigned int>(indices.size()));
-    };
-
-    std::vector<Vector2> healthBg;
-    healthBg.emplace_back(Vector2(20.0f, 20.0f));
-    healthBg.emplace_back(Vector2(220.0f, 20.0f));
-    healthBg.emplace_back(Vector2(220.0f, 40.0f));
-    healthBg.emplace_back(Vector2(20.0f, 40.0f));
-
-    Matrix4 healthBgMatrix = Matrix4::Identity;
-    VertexArray* healthBgVA = createVA(healthBg);
-    Vector3 healthBgColor(0.2f, 0.2f, 0.2f);
-    mRenderer->Draw(healthBgMatrix, healthBgVA, healthBgColor);
-    delete healthBgVA;
-
-    std::vector<Vector2> healthBar;
-    healthBar.emplace_back(Vector2(20.0f, 20.0f));
-    healthBar.emplace_back(Vector2(20.0f + 200.0f * healthPercent, 20.0f));
-    healthBar.emplace_back(Vector2(20.0f + 200.0f * healthPercent, 40.0f));
-    healthBar.emplace_back(Vector2(20.0f, 40.0f));
-
-    Matrix4 healthMatrix = Matrix4::Identity;
-    VertexArray* healthVA = createVA(healthBar);
-    Vector3 healthColor(1.0f - healthPercent, healthPercent, 0.0f);
-    mRenderer->Draw(healthMatrix, healthVA, healthColor);
-    delete healthVA;
+    ui->Rect(Vector2(20.0f, 20.0f), Vector2(200.0f, 20.0f), Vector3(0.2f, 0.2f, 0.2f));
+    ui->Rect(Vector2(20.0f, 20.0f), Vector2(200.0f * healthPercent, 20.0f), Vector3(1.0f - healthPercent, healthPercent, 0.0f));
 
     // Draw experience bar - improved visual design
     float expPercent = Math::Clamp(mPlayer->GetExperience() / mPlayer->GetExperienceToNextLevel(), 0.0f, 1.0f);
-    std::vector<Vector2> expBg;
-    expBg.emplace_back(Vector2(20.0f, 50.0f));
-    expBg.emplace_back(Vector2(220.0f, 50.0f));
-    expBg.emplace_back(Vector2(220.0f, 62.0f));  // Slightly taller
-    expBg.emplace_back(Vector2(20.0f, 62.0f));
-
-    Matrix4 expBgMatrix = Matrix4::Identity;
-    VertexArray* expBgVA = createVA(expBg);
-    Vector3 expBgColor(0.15f, 0.15f, 0.2f);  // Darker, more visible
-    mRenderer->Draw(expBgMatrix, expBgVA, expBgColor);
-    delete expBgVA;
-
-    std::vector<Vector2> expBar;
-    expBar.emplace_back(Vector2(20.0f, 50.0f));
-    expBar.emplace_back(Vector2(20.0f + 200.0f * expPercent, 50.0f));
-    expBar.emplace_back(Vector2(20.0f + 200.0f * expPercent, 62.0f));
-    expBar.emplace_back(Vector2(20.0f, 62.0f));
-
-    Matrix4 expMatrix = Matrix4::Identity;
-    VertexArray* expVA = createVA(expBar);
+    ui->Rect(Vector2(20.0f, 50.0f), Vector2(200.0f, 12.0f), Vector3(0.15f, 0.15f, 0.2f));  // Slightly taller, darker
     // Brighter, more vibrant cyan color
-    Vector3 expColor(0.1f, 0.9f, 1.0f);
-    mRenderer->Draw(expMatrix, expVA, expColor);
-    delete expVA;
+    ui->Rect(Vector2(20.0f, 50.0f), Vector2(200.0f * expPercent, 12.0f), Vector3(0.1f, 0.9f, 1.0f));
 
     // Wave panel
-    std::vector<Vector2> waveBg;
-    waveBg.emplace_back(Vector2(static_cast<float>(WINDOW_WIDTH) - 150.0f, 20.0f));
-    waveBg.emplace_back(Vector2(static_cast<float>(WINDOW_WIDTH) - 20.0f, 20.0f));
-    waveBg.emplace_back(Vector2(static_cast<float>(WINDOW_WIDTH) - 20.0f, 60.0f));
-    waveBg.emplace_back(Vector2(static_cast<float>(WINDOW_WIDTH) - 150.0f, 60.0f));
-
-    Matrix4 waveMatrix = Matrix4::Identity;
-    VertexArray* waveVA = createVA(waveBg);
-    Vector3 waveColor(0.3f, 0.3f, 0.4f);
-    mRenderer->Draw(waveMatrix, waveVA, waveColor);
-    delete waveVA;
+    ui->Rect(Vector2(static_cast<float>(WINDOW_WIDTH) - 150.0f, 20.0f), Vector2(130.0f, 40.0f), Vector3(0.3f, 0.3f, 0.4f));
 
     // Labels - improved visibility with better contrast
     TextRenderer::DrawText(mRenderer, "HP",  Vector2(25.0f,  5.0f), 0.85f, Vector3(1.0f, 0.5f, 0.5f));  // Brighter red
@@ -1208,31 +1242,10 @@ void Game::DrawUI()
             const float barY = 40.0f; // Posição Y (perto do topo)
 
             // 1. Desenha o fundo da barra (cinza escuro)
-            std::vector<Vector2> bossBg;
-            bossBg.emplace_back(Vector2(barX, barY));
-            bossBg.emplace_back(Vector2(barX + barWidth, barY));
-            bossBg.emplace_back(Vector2(barX + barWidth, barY + barHeight));
-            bossBg.emplace_back(Vector2(barX, barY + barHeight));
-
-            Matrix4 bossBgMatrix = Matrix4::Identity;
-            VertexArray* bossBgVA = createVA(bossBg);
-            Vector3 bossBgColor(0.2f, 0.2f, 0.2f); // Cinza escuro
-            mRenderer->Draw(bossBgMatrix, bossBgVA, bossBgColor);
-            delete bossBgVA;
-
-            // 2. Desenha a barra de vida (vermelha)
-            std::vector<Vector2> bossHealth;
-            bossHealth.emplace_back(Vector2(barX, barY));
-            bossHealth.emplace_back(Vector2(barX + barWidth * healthPercent, barY));
-            bossHealth.emplace_back(Vector2(barX + barWidth * healthPercent, barY + barHeight));
-            bossHealth.emplace_back(Vector2(barX, barY + barHeight));
-
-            Matrix4 bossHealthMatrix = Matrix4::Identity;
-            VertexArray* bossHealthVA = createVA(bossHealth);
-            // Cor (vermelho-roxo, para combinar com o chefe)
-            Vector3 bossHealthColor(0.9f, 0.1f, 0.5f);
-            mRenderer->Draw(bossHealthMatrix, bossHealthVA, bossHealthColor);
-            delete bossHealthVA;
+            ui->Rect(Vector2(barX, barY), Vector2(barWidth, barHeight), Vector3(0.2f, 0.2f, 0.2f));
+
+            // 2. Desenha a barra de vida (vermelho-roxo, para combinar com o chefe)
+            ui->Rect(Vector2(barX, barY), Vector2(barWidth * healthPercent, barHeight), Vector3(0.9f, 0.1f, 0.5f));
 
             // 3. Desenha o rótulo "BOSS"
             // Centraliza o texto acima da barra
@@ -1264,86 +1277,145 @@ void Game::CleanupGame()
     mPlayer = nullptr;
     
     // Clear all actor reference lists BEFORE deleting to prevent destructors from accessing cleared vectors
-    // The actual actors will be deleted via mActors
-    mEnemies.clear();
-    mProjectiles.clear();
+    // The actual actors will be deleted via mActorRegistry
+    mEnemySystem.Clear();
+    mProjectileSystem.Clear();
+    mParticleSystem.Clear();
     mBosses.clear();
     mExperienceOrbs.clear();
     mDeferredExperience.clear();
+    mEnemyGrid.Clear();
+    mOrbGrid.Clear();
 
     // Clear drawables before deleting actors (their destructors try to remove themselves)
     mDrawables.clear();
+    mDrawablesDirty = false;
 
     // Remove all actors (this will delete them)
-    // Their destructors might try to remove themselves from vectors, but we've already cleared them
-    while (!mActors.empty())
+    // Their handles are already invalid, so RemoveActor in the destructors does nothing
+    for (auto actor : mActorRegistry.ReleaseAll())
     {
-        Actor* actor = mActors.back();
-        mActors.pop_back();
         delete actor;
     }
 }
 
-void Game::AddActor(Actor* actor)
+ActorHandle Game::AddActor(Actor* actor)
 {
-    if (mUpdatingActors)
-    {
-        mPendingActors.emplace_back(actor);
-    }
-    else
-    {
-        mActors.emplace_back(actor);
-    }
+    return mActorRegistry.Add(actor);
 }
 
 void Game::RemoveActor(Actor* actor)
 {
     if (!actor) return;  // Safety check
 
-    // Don't remove if we're currently updating actors (to avoid iterator invalidation)
-    // The UpdateActors function handles removal itself
-    if (mUpdatingActors)
+    // Stale handles are ignored, so removing twice is safe
+    mActorRegistry.Remove(actor->GetHandle());
+}
+
+void Game::AddDrawable(class DrawComponent *drawable)
+{
+    auto& layer = mDrawables[drawable->GetDrawOrder()];
+    drawable->SetDrawIndex(static_cast<int>(layer.size()));
+    layer.emplace_back(drawable);
+}
+
+void Game::RemoveDrawable(class DrawComponent *drawable)
+{
+    if (!drawable) return;
+
+    // Stale or cleared indices are ignored, so removing twice is safe
+    auto iter = mDrawables.find(drawable->GetDrawOrder());
+    if (iter == mDrawables.end())
     {
         return;
     }
 
-    // Remove from pending actors first
-    auto iter = std::find(mPendingActors.begin(), mPendingActors.end(), actor);
-    if (iter != mPendingActors.end())
+    auto& layer = iter->second;
+    int index = drawable->GetDrawIndex();
+    if (index < 0 || index >= static_cast<int>(layer.size()) || layer[index] != drawable)
     {
-        std::iter_swap(iter, mPendingActors.end() - 1);
-        mPendingActors.pop_back();
+        return;
     }
 
-    // Remove from main actors list
-    iter = std::find(mActors.begin(), mActors.end(), actor);
-    if (iter != mActors.end())
+    // Compacted after the actor update, so the order of the rest is kept
+    layer[index] = nullptr;
+    drawable->SetDrawIndex(-1);
+    mDrawablesDirty = true;
+}
+
+void Game::CompactDrawables()
+{
+    if (!mDrawablesDirty)
     {
-        std::iter_swap(iter, mActors.end() - 1);
-        mActors.pop_back();
+        return;
     }
 
-    // Note: It's safe if the actor isn't found - this can happen if it was
-    // already removed manually before deletion (which we do in UpdateActors)
+    for (auto& layer : mDrawables)
+    {
+        auto& drawables = layer.second;
+        int count = 0;
+        for (auto drawable : drawables)
+        {
+            if (drawable)
+            {
+                drawable->SetDrawIndex(count);
+                drawables[count++] = drawable;
+            }
+        }
+        drawables.resize(count);
+    }
+    mDrawablesDirty = false;
 }
 
-void Game::AddDrawable(class DrawComponent *drawable)
+void Game::UpdateViewBounds()
 {
-    mDrawables.emplace_back(drawable);
-
-    std::sort(mDrawables.begin(), mDrawables.end(), [](DrawComponent* a, DrawComponent* b) {
-        return a->GetDrawOrder() < b->GetDrawOrder();
-    });
+    // Shake is already in the camera position; the margin covers rounding
+    // and anything drawn slightly outside its bounding radius
+    Vector2 halfView(WINDOW_WIDTH / 2.0f + VIEW_MARGIN, WINDOW_HEIGHT / 2.0f + VIEW_MARGIN);
+    Vector2 camera = GetRenderCameraPosition();
+    mViewMin = camera - halfView;
+    mViewMax = camera + halfView;
 }
 
-void Game::RemoveDrawable(class DrawComponent *drawable)
+void Game::DrawWorld()
 {
-    if (!drawable) return;
-    auto iter = std::find(mDrawables.begin(), mDrawables.end(), drawable);
-    if (iter != mDrawables.end())
+    UpdateViewBounds();
+    // Uma vez por frame; os draws do mundo mandam só o modelo
+    mRenderer->SetCamera(GetRenderCameraPosition());
+
+    if (mBackground)
+    {
+        mBackground->Draw(mRenderer);
+    }
+
+    // Inimigos comuns: uma chamada instanciada por tipo, no início da camada
+    // deles (mesma ordem que os animators teriam)
+    bool enemiesDrawn = false;
+
+    // Fora da câmera não desenha
+    for (const auto& layer : mDrawables)
     {
-        mDrawables.erase(iter);
+        if (!enemiesDrawn && layer.first >= EnemySystem::DRAW_ORDER)
+        {
+            mEnemySystem.Draw(mRenderer, mViewMin, mViewMax);
+            enemiesDrawn = true;
+        }
+
+        for (auto drawable : layer.second)
+        {
+            // Removed since the last compaction
+            if (drawable && drawable->IsInView(mViewMin, mViewMax))
+            {
+                drawable->Draw(mRenderer);
+            }
+        }
     }
+    if (!enemiesDrawn)
+    {
+        mEnemySystem.Draw(mRenderer, mViewMin, mViewMax);
+    }
+    mProjectileSystem.Draw(mRenderer, mRenderAlpha, mViewMin, mViewMax);
+    mParticleSystem.Draw(mRenderer, mViewMin, mViewMax);
 }
 
 void Game::GenerateOutput()
@@ -1356,43 +1428,19 @@ void Game::GenerateOutput()
     }
     else if (mGameState == MenuState::Paused)
     {
-        if (mBackground)
-        {
-            mBackground->Draw(mRenderer);
-        }
-        
-        for (auto drawable : mDrawables)
-        {
-            drawable->Draw(mRenderer);
-        }
+        DrawWorld();
         DrawUI();
         mPauseMenu->Draw(mRenderer);
     }
     else if (mGameState == MenuState::UpgradeMenu)
     {
-        if (mBackground)
-        {
-            mBackground->Draw(mRenderer);
-        }
-        
-        for (auto drawable : mDrawables)
-        {
-            drawable->Draw(mRenderer);
-        }
+        DrawWorld();
         DrawUI();
         mUpgradeMenu->Draw(mRenderer);
     }
     else if (mGameState == MenuState::Playing || mGameState == MenuState::GameOver)
     {
-        if (mBackground)
-        {
-            mBackground->Draw(mRenderer);
-        }
-        
-        for (auto drawable : mDrawables)
-        {
-            drawable->Draw(mRenderer);
-        }
+        DrawWorld();
 
         DrawUI();
 
@@ -1411,13 +1459,20 @@ void Game::GenerateOutput()
         }
         else if (mIsDebugging)
         {
-            for (auto actor : mActors)
+            for (size_t i = 0; i < mActorRegistry.Size(); ++i)
             {
-                for (auto component : actor->GetComponents())
+                for (auto component : mActorRegistry.At(i)->GetComponents())
                 {
                     component->DebugDraw(mRenderer);
                 }
             }
+
+            // Binds do último frame desenhado
+            GLStateCache::Stats binds = mRenderer->GetBindStats();
+            std::string bindsText = "GL binds: " + std::to_string(binds.issued) + " issued, " +
+                                    std::to_string(binds.skipped) + " skipped";
+            TextRenderer::DrawText(mRenderer, bindsText, Vector2(10.0f, WINDOW_HEIGHT - 24.0f), 0.6f,
+                                   Vector3(0.6f, 1.0f, 0.6f));
         }
     }
 
@@ -1439,11 +1494,19 @@ void Game::Shutdown()
         mAudioSystem = nullptr;
     }
 
-    TextRenderer::Shutdown();
-    mRenderer->Shutdown();
-    delete mRenderer;
-    mRenderer = nullptr;
+    if (mRenderer)
+    {
+        // Glyph atlases are freed with the GL context back on this thread
+        mRenderer->StopRenderThread();
+        TextRenderer::Shutdown();
+        mRenderer->Shutdown();
+        delete mRenderer;
+        mRenderer = nullptr;
+    }
+    else if (mWindow)
+    {
+        SDL_DestroyWindow(mWindow);
+    }
 
-    SDL_DestroyWindow(mWindow);
     SDL_Quit();
 }
\ No newline at end of file
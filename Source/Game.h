@@ -1,13 +1,20 @@
 #pragma once
 #include <SDL.h>
+#include <map>
 #include <vector>
 #include "Renderer/Renderer.h"
 #include "Audio/AudioSystem.h"
+#include "Systems/ActorRegistry.h"
+#include "Systems/SpatialGrid.h"
+#include "Systems/EnemySystem.h"
+#include "Systems/ProjectileSystem.h"
+#include "Systems/ParticleSystem.h"
+#include "Systems/Profiler.h"
 
 // ============================================
 //  NOVOS ENUMS E ESTRUTURAS DE SPAWN
 // ============================================
-enum class EnemyKind { Comum, Corredor, GordoExplosivo, Atirador };
+// EnemyKind fica em Systems/EnemySystem.h (o sistema dimensiona arrays por tipo)
 
 
 enum class BossKind
@@ -51,6 +58,19 @@ public:
     bool Initialize();
     void RunLoop();
     void Shutdown();
+
+    // Headless: no window, GL context, text renderer or audio; must be set
+    // before Initialize. RunHeadless steps the simulation as fast as possible
+    void SetHeadless(bool headless) { mIsHeadless = headless; }
+    bool IsHeadless() const { return mIsHeadless; }
+    void RunHeadless(float seconds);
+    // Draw on a separate render thread (default); must be set before Initialize
+    void SetRenderThread(bool renderThread) { mUseRenderThread = renderThread; }
+    // One fixed step, auto-picking upgrades; false once the run is over
+    bool StepHeadless();
+    // Moves the wave clock forward without replaying earlier spawns or bosses
+    void JumpToWave(int wave);
+    Profiler& GetProfiler() { return mProfiler; }
     void Quit() { mIsRunning = false; }
 
     // --------------------------------
@@ -64,8 +84,9 @@ public:
     // Existing declarations ...
     void InitializeActors();
     void UpdateActors(float deltaTime);
-    void AddActor(class Actor* actor);
+    ActorHandle AddActor(class Actor* actor);
     void RemoveActor(class Actor* actor);
+    class Actor* GetActor(ActorHandle handle) const { return mActorRegistry.Get(handle); }
 
     class Renderer* GetRenderer() { return mRenderer; }
     AudioSystem* GetAudioSystem() { return mAudioSystem; }
@@ -74,31 +95,47 @@ public:
     static const int WINDOW_HEIGHT = 768;
     static const int WORLD_WIDTH = 4000;
     static const int WORLD_HEIGHT = 4000;
+    static constexpr float GRID_CELL_SIZE = 64.0f;
+
+    // Simulation runs in fixed steps of 1 / tick rate; rendering interpolates
+    // between the last two steps
+    static const int DEFAULT_TICK_RATE = 60;
+    void SetTickRate(int ticksPerSecond);
+    float GetFixedDeltaTime() const { return mFixedDeltaTime; }
+    // Fraction of a step elapsed since the last one, in [0, 1)
+    float GetRenderAlpha() const { return mRenderAlpha; }
 
     void AddDrawable(class DrawComponent* drawable);
     void RemoveDrawable(class DrawComponent* drawable);
 
-    std::vector<class DrawComponent*>& GetDrawables() { return mDrawables; }
+    // Draw order -> drawables with that order, drawn in ascending key order
+    using DrawLayers = std::map<int, std::vector<class DrawComponent*>>;
+    const DrawLayers& GetDrawables() const { return mDrawables; }
 
     class Player* GetPlayer() const { return mPlayer; }
 
     Vector2 GetCameraPosition() const { return mCameraPosition; }
+    Vector2 GetRenderCameraPosition() const { return Vector2::Lerp(mPrevCameraPosition, mCameraPosition, mRenderAlpha); }
     void UpdateCamera(float deltaTime);
     void AddScreenShake(float intensity, float duration = 0.2f);
     void SpawnExplosionParticles(const Vector2& position, const Vector3& color);
 
-    void AddEnemy(class Enemy* enemy);
+    void AddEnemy(class Enemy* enemy, EnemyKind kind, float radius, float speed, float health);
     void RemoveEnemy(class Enemy* enemy);
-    std::vector<class Enemy*>& GetEnemies() { return mEnemies; }
+    const std::vector<class Enemy*>& GetEnemies() const { return mEnemySystem.GetEnemies(); }
+    EnemySystem& GetEnemySystem() { return mEnemySystem; }
 
-    void AddProjectile(class Projectile* projectile);
-    void RemoveProjectile(class Projectile* projectile);
-    std::vector<class Projectile*>& GetProjectiles() { return mProjectiles; }
+    ProjectileSystem& GetProjectileSystem() { return mProjectileSystem; }
+    ParticleSystem& GetParticleSystem() { return mParticleSystem; }
     
     void SpawnExperienceOrb(const Vector2& position, float experienceValue);
     void AddExperienceOrb(class ExperienceOrb* orb);
     void RemoveExperienceOrb(class ExperienceOrb* orb);
     std::vector<class ExperienceOrb*>& GetExperienceOrbs() { return mExperienceOrbs; }
+
+    // Broadphase grids, rebuilt at the start of every UpdateActors
+    const SpatialGrid<class Enemy>& GetEnemyGrid() const { return mEnemyGrid; }
+    const SpatialGrid<class ExperienceOrb>& GetOrbGrid() const { return mOrbGrid; }
     
     // Deferred experience system - prevents crashes from state changes during updates
     struct DeferredExperience
@@ -151,23 +188,44 @@ public:
 private:
     void ProcessInput();
     void UpdateGame();
+    void StepSimulation(float deltaTime);
+    void SaveRenderState();
+    void WaitForNextTick();
     void GenerateOutput();
+    // Background, enemies, drawables, projectiles and particles inside the view
+    void DrawWorld();
+    void UpdateViewBounds();
     void UpdateWaveSystem(float deltaTime);
+    void RebuildSpatialGrids(float deltaTime);
     void SpawnEnemies(int count);
     void DrawUI();
     void CleanupGame();
+    void CompactDrawables();
 
     // Atores e Drawables
-    std::vector<class Actor*> mActors;
-    std::vector<class Actor*> mPendingActors;
-    std::vector<class DrawComponent*> mDrawables;
+    ActorRegistry mActorRegistry;
+    // Add is an append and remove leaves a null in its slot (found by the
+    // DrawComponent's index); CompactDrawables drops the nulls in order, so
+    // drawables keep their order within a layer
+    DrawLayers mDrawables;
+    bool mDrawablesDirty = false;
 
     SDL_Window* mWindow;
     class Renderer* mRenderer;
     AudioSystem* mAudioSystem;
 
-    Uint32 mTicksCount;
+    Profiler mProfiler;
+
+    // Fixed timestep
+    static constexpr double MAX_FRAME_TIME = 0.25;
+    Uint64 mLastCounter;
+    double mAccumulator;
+    float mFixedDeltaTime;
+    float mRenderAlpha;
+
     bool mIsRunning;
+    bool mIsHeadless;
+    bool mUseRenderThread;
     bool mIsDebugging;
     bool mUpdatingActors;
     Uint32 mLastPausePress;
@@ -178,9 +236,13 @@ private:
     class UpgradeMenu* mUpgradeMenu;
 
     class Player* mPlayer;
-    std::vector<class Enemy*> mEnemies;
-    std::vector<class Projectile*> mProjectiles;
+    EnemySystem mEnemySystem;
+    ProjectileSystem mProjectileSystem;
+    ParticleSystem mParticleSystem;
     std::vector<class ExperienceOrb*> mExperienceOrbs;
+
+    SpatialGrid<class Enemy> mEnemyGrid;
+    SpatialGrid<class ExperienceOrb> mOrbGrid;
     
     // Deferred experience system - prevents crashes from state changes during updates
     std::vector<DeferredExperience> mDeferredExperience;
@@ -206,6 +268,12 @@ private:
     // -------------------------------
 
     Vector2 mCameraPosition;
+    Vector2 mPrevCameraPosition;
+
+    // World-space rectangle drawn this frame (see UpdateViewBounds)
+    static constexpr float VIEW_MARGIN = 32.0f;
+    Vector2 mViewMin;
+    Vector2 mViewMax;
     float mScreenShakeAmount;
     float mScreenShakeDuration;
 
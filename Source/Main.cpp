@@ -6,15 +6,51 @@
 //  Copyright © 2017 Sanjay Madhav. All rights reserved.
 //
 
+#include <cstdlib>
+#include <cstring>
 #include "Game.h"
 
 int main(int argc, char** argv)
 {
     Game game;
+
+    // --tick-rate <hz>: simulation steps per second (default 60)
+    // --headless [--seconds <s>]: run the simulation without window or audio
+    // --no-render-thread: issue GL calls from the main thread
+    bool headless = false;
+    float seconds = 60.0f;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--tick-rate") == 0 && i + 1 < argc)
+        {
+            game.SetTickRate(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--headless") == 0)
+        {
+            headless = true;
+        }
+        else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc)
+        {
+            seconds = static_cast<float>(atof(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--no-render-thread") == 0)
+        {
+            game.SetRenderThread(false);
+        }
+    }
+    game.SetHeadless(headless);
+
     bool success = game.Initialize();
     if (success)
     {
-        game.RunLoop();
+        if (headless)
+        {
+            game.RunHeadless(seconds);
+        }
+        else
+        {
+            game.RunLoop();
+        }
     }
     game.Shutdown();
     return 0;
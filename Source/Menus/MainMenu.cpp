@@ -1,7 +1,7 @@
 #include "MainMenu.h"
 #include "../Game.h"
 #include "../Renderer/Renderer.h"
-#include "../Renderer/VertexArray.h"
+#include "../Renderer/UIDrawList.h"
 #include "../Renderer/TextRenderer.h"
 #include "../Renderer/Texture.h"
 #include "../Components/DrawComponent.h"
@@ -11,7 +11,10 @@ MainMenu::MainMenu(Game* game)
     , mMusicStarted(false)
     , mBackgroundTexture(nullptr)
 {
-    mBackgroundTexture = game->GetRenderer()->GetTexture("../Assets/Menu/menu_background.png");
+    if (game->GetRenderer())
+    {
+        mBackgroundTexture = game->GetRenderer()->GetTexture("../Assets/Menu/menu_background.png");
+    }
     MenuItem startItem;
     startItem.text = "Start Game";
     startItem.position = Vector2(static_cast<float>(Game::WINDOW_WIDTH) / 2.0f - 100.0f, static_cast<float>(Game::WINDOW_HEIGHT) / 2.0f);
@@ -42,43 +45,18 @@ void MainMenu::Draw(Renderer* renderer)
         }
     }
 
+    UIDrawList* ui = renderer->GetUIDrawList();
+
     if (mBackgroundTexture)
     {
-        Vector4 flippedRect(0.0f, 1.0f, 1.0f, -1.0f);
-        renderer->DrawTexture(Vector2(0.0f, 0.0f),
-                            Vector2(static_cast<float>(Game::WINDOW_WIDTH), 
-                                   static_cast<float>(Game::WINDOW_HEIGHT)),
-                            0.0f,
-                            Vector3(1.0f, 1.0f, 1.0f),
-                            mBackgroundTexture,
-                            flippedRect,
-                            Vector2::Zero,
-                            false,
-                            1.0f);
+        ui->Image(Vector2::Zero, Vector2(static_cast<float>(Game::WINDOW_WIDTH), static_cast<float>(Game::WINDOW_HEIGHT)),
+                  mBackgroundTexture);
     }
 
     Menu::Draw(renderer);
     
-    std::vector<Vector2> titleBg;
-    titleBg.emplace_back(Vector2(static_cast<float>(Game::WINDOW_WIDTH) / 2.0f - 150.0f, 100.0f));
-    titleBg.emplace_back(Vector2(static_cast<float>(Game::WINDOW_WIDTH) / 2.0f + 150.0f, 100.0f));
-    titleBg.emplace_back(Vector2(static_cast<float>(Game::WINDOW_WIDTH) / 2.0f + 150.0f, 180.0f));
-    titleBg.emplace_back(Vector2(static_cast<float>(Game::WINDOW_WIDTH) / 2.0f - 150.0f, 180.0f));
-    
-    std::vector<float> titleFloatArray;
-    std::vector<unsigned int> titleIndices;
-    for (size_t i = 0; i < titleBg.size(); ++i)
-    {
-        titleFloatArray.push_back(titleBg[i].x);
-        titleFloatArray.push_back(titleBg[i].y);
-        titleFloatArray.push_back(0.0f);
-        titleIndices.push_back(static_cast<unsigned int>(i));
-    }
-    
-    Matrix4 titleMatrix = Matrix4::Identity;
-    VertexArray titleVA(titleFloatArray.data(), static_cast<unsigned int>(titleBg.size()), titleIndices.data(), static_cast<unsigned int>(titleIndices.size()));
-    Vector3 titleColor(0.8f, 0.2f, 0.2f);
-    renderer->Draw(titleMatrix, &titleVA, titleColor);
+    ui->Rect(Vector2(static_cast<float>(Game::WINDOW_WIDTH) / 2.0f - 150.0f, 100.0f), Vector2(300.0f, 80.0f),
+             Vector3(0.8f, 0.2f, 0.2f));
     
     // Draw title text
     Vector2 titleTextPos(static_cast<float>(Game::WINDOW_WIDTH) / 2.0f - 140.0f, 130.0f);
@@ -2,7 +2,7 @@
 #include "../Game.h"
 #include "../Actors/Player.h"
 #include "../Renderer/Renderer.h"
-#include "../Renderer/VertexArray.h"
+#include "../Renderer/UIDrawList.h"
 #include "../Renderer/TextRenderer.h"
 #include "../Components/DrawComponent.h"
 #include "../Random.h"
@@ -42,28 +42,7 @@ void UpgradeMenu::ProcessInput(const Uint8* keyState)
     {
         if (currentTime - mLastKeyPress > 200)
         {
-            if (mSelectedIndex >= 0 && mSelectedIndex < static_cast<int>(mAvailableUpgrades.size()))
-            {
-                if (mAvailableUpgrades[mSelectedIndex].onSelect)
-                {
-                    mAvailableUpgrades[mSelectedIndex].onSelect();
-                    
-                    auto* player = mGame->GetPlayer();
-                    if (player)
-                    {
-                        player->DecrementPendingUpgrades();
-                    }
-                    
-                    if (player && player->GetPendingUpgrades() > 0)
-                    {
-                        GenerateUpgrades();
-                    }
-                    else
-                    {
-                        mGame->ResumeGame();
-                    }
-                }
-            }
+            ChooseUpgrade(mSelectedIndex);
             mLastKeyPress = currentTime;
         }
     }
@@ -77,51 +56,42 @@ void UpgradeMenu::ProcessInput(const Uint8* keyState)
     }
 }
 
-void UpgradeMenu::Draw(Renderer* renderer)
+void UpgradeMenu::ChooseUpgrade(int index)
 {
-    // Draw semi-transparent background overlay
-    std::vector<Vector2> bgVertices;
-    bgVertices.emplace_back(Vector2(0.0f, 0.0f));
-    bgVertices.emplace_back(Vector2(static_cast<float>(Game::WINDOW_WIDTH), 0.0f));
-    bgVertices.emplace_back(Vector2(static_cast<float>(Game::WINDOW_WIDTH), static_cast<float>(Game::WINDOW_HEIGHT)));
-    bgVertices.emplace_back(Vector2(0.0f, static_cast<float>(Game::WINDOW_HEIGHT)));
-    
-    std::vector<float> bgFloatArray;
-    std::vector<unsigned int> bgIndices;
-    for (size_t i = 0; i < bgVertices.size(); ++i)
+    if (index < 0 || index >= static_cast<int>(mAvailableUpgrades.size()) || !mAvailableUpgrades[index].onSelect)
     {
-        bgFloatArray.push_back(bgVertices[i].x);
-        bgFloatArray.push_back(bgVertices[i].y);
-        bgFloatArray.push_back(0.0f);
-        bgIndices.push_back(static_cast<unsigned int>(i));
+        return;
     }
-    
-    Matrix4 bgMatrix = Matrix4::Identity;
-    VertexArray bgVA(bgFloatArray.data(), static_cast<unsigned int>(bgVertices.size()), bgIndices.data(), static_cast<unsigned int>(bgIndices.size()));
-    Vector3 bgColor(0.05f, 0.05f, 0.1f);  // Dark blue background
-    renderer->Draw(bgMatrix, &bgVA, bgColor);
-    
-    // Draw title background
-    std::vector<Vector2> titleBg;
-    titleBg.emplace_back(Vector2(static_cast<float>(Game::WINDOW_WIDTH) / 2.0f - 200.0f, 30.0f));
-    titleBg.emplace_back(Vector2(static_cast<float>(Game::WINDOW_WIDTH) / 2.0f + 200.0f, 30.0f));
-    titleBg.emplace_back(Vector2(static_cast<float>(Game::WINDOW_WIDTH) / 2.0f + 200.0f, 90.0f));
-    titleBg.emplace_back(Vector2(static_cast<float>(Game::WINDOW_WIDTH) / 2.0f - 200.0f, 90.0f));
-    
-    std::vector<float> titleFloatArray;
-    std::vector<unsigned int> titleIndices;
-    for (size_t i = 0; i < titleBg.size(); ++i)
+
+    mAvailableUpgrades[index].onSelect();
+
+    auto* player = mGame->GetPlayer();
+    if (player)
     {
-        titleFloatArray.push_back(titleBg[i].x);
-        titleFloatArray.push_back(titleBg[i].y);
-        titleFloatArray.push_back(0.0f);
-        titleIndices.push_back(static_cast<unsigned int>(i));
+        player->DecrementPendingUpgrades();
     }
+
+    if (player && player->GetPendingUpgrades() > 0)
+    {
+        GenerateUpgrades();
+    }
+    else
+    {
+        mGame->ResumeGame();
+    }
+}
+
+void UpgradeMenu::Draw(Renderer* renderer)
+{
+    UIDrawList* ui = renderer->GetUIDrawList();
+
+    // Draw semi-transparent background overlay
+    ui->Rect(Vector2::Zero, Vector2(static_cast<float>(Game::WINDOW_WIDTH), static_cast<float>(Game::WINDOW_HEIGHT)),
+             Vector3(0.05f, 0.05f, 0.1f));  // Dark blue background
     
-    Matrix4 titleMatrix = Matrix4::Identity;
-    VertexArray titleVA(titleFloatArray.data(), static_cast<unsigned int>(titleBg.size()), titleIndices.data(), static_cast<unsigned int>(titleIndices.size()));
-    Vector3 titleColor(0.1f, 0.3f, 0.5f);
-    renderer->Draw(titleMatrix, &titleVA, titleColor);
+    // Draw title background
+    ui->Rect(Vector2(static_cast<float>(Game::WINDOW_WIDTH) / 2.0f - 200.0f, 30.0f), Vector2(400.0f, 60.0f),
+             Vector3(0.1f, 0.3f, 0.5f));
     
     // Draw title text - make it bigger and more visible
     TextRenderer::DrawText(renderer, "LEVEL UP!", Vector2(static_cast<float>(Game::WINDOW_WIDTH) / 2.0f - 140.0f, 45.0f), 1.8f, Vector3(1.0f, 1.0f, 0.0f));
@@ -135,29 +105,10 @@ void UpgradeMenu::Draw(Renderer* renderer)
         bool isSelected = (static_cast<int>(i) == mSelectedIndex);
         
         // Draw upgrade box with border - make selection more visible
-        std::vector<Vector2> upgradeVertices;
         float boxWidth = 450.0f;
         float boxHeight = 70.0f;
         float xCenter = static_cast<float>(Game::WINDOW_WIDTH) / 2.0f;
         
-        upgradeVertices.emplace_back(Vector2(xCenter - boxWidth/2, yPos));
-        upgradeVertices.emplace_back(Vector2(xCenter + boxWidth/2, yPos));
-        upgradeVertices.emplace_back(Vector2(xCenter + boxWidth/2, yPos + boxHeight));
-        upgradeVertices.emplace_back(Vector2(xCenter - boxWidth/2, yPos + boxHeight));
-        
-        std::vector<float> upgradeFloatArray;
-        std::vector<unsigned int> upgradeIndices;
-        for (size_t j = 0; j < upgradeVertices.size(); ++j)
-        {
-            upgradeFloatArray.push_back(upgradeVertices[j].x);
-            upgradeFloatArray.push_back(upgradeVertices[j].y);
-            upgradeFloatArray.push_back(0.0f);
-            upgradeIndices.push_back(static_cast<unsigned int>(j));
-        }
-        
-        Matrix4 upgradeMatrix = Matrix4::Identity;
-        VertexArray upgradeVA(upgradeFloatArray.data(), static_cast<unsigned int>(upgradeVertices.size()), upgradeIndices.data(), static_cast<unsigned int>(upgradeIndices.size()));
-        
         // Use rarity color for background
         Vector3 rarityColor = GetRarityColor(upgrade.rarity);
         Vector3 bgColor;
@@ -169,30 +120,15 @@ void UpgradeMenu::Draw(Renderer* renderer)
         {
             bgColor = Vector3(rarityColor.x * 0.2f, rarityColor.y * 0.2f, rarityColor.z * 0.2f);
         }
-        renderer->Draw(upgradeMatrix, &upgradeVA, bgColor);
+        ui->Rect(Vector2(xCenter - boxWidth/2, yPos), Vector2(boxWidth, boxHeight), bgColor);
         
         // Draw selection indicator - make it bigger and more visible
         if (isSelected)
         {
-            std::vector<Vector2> indicator;
             float indSize = 8.0f;
-            indicator.emplace_back(Vector2(xCenter - boxWidth/2 - 15, yPos + boxHeight/2 - indSize));
-            indicator.emplace_back(Vector2(xCenter - boxWidth/2 - 15, yPos + boxHeight/2 + indSize));
-            indicator.emplace_back(Vector2(xCenter - boxWidth/2 - 5, yPos + boxHeight/2));
-            
-            std::vector<float> indFloatArray;
-            std::vector<unsigned int> indIndices;
-            for (size_t j = 0; j < indicator.size(); ++j)
-            {
-                indFloatArray.push_back(indicator[j].x);
-                indFloatArray.push_back(indicator[j].y);
-                indFloatArray.push_back(0.0f);
-                indIndices.push_back(static_cast<unsigned int>(j));
-            }
-            
-            Matrix4 indMatrix = Matrix4::Identity;
-            VertexArray indVA(indFloatArray.data(), static_cast<unsigned int>(indicator.size()), indIndices.data(), static_cast<unsigned int>(indIndices.size()));
-            renderer->Draw(indMatrix, &indVA, Vector3(1.0f, 0.8f, 0.0f));
+            ui->Outline({ Vector2(xCenter - boxWidth/2 - 15, yPos + boxHeight/2 - indSize),
+                          Vector2(xCenter - boxWidth/2 - 15, yPos + boxHeight/2 + indSize),
+                          Vector2(xCenter - boxWidth/2 - 5, yPos + boxHeight/2) }, Vector3(1.0f, 0.8f, 0.0f));
         }
         
         // Draw upgrade text with rarity color (reuse rarityColor from above)
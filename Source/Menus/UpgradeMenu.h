@@ -25,6 +25,11 @@ public:
     void ProcessInput(const Uint8* keyState) override;
     void Draw(class Renderer* renderer) override;
     void GenerateUpgrades();
+
+    // Applies the upgrade at index and resumes the game (or rolls the next
+    // set if more upgrades are pending)
+    void ChooseUpgrade(int index);
+    int GetNumUpgrades() const { return static_cast<int>(mAvailableUpgrades.size()); }
     
 private:
     std::vector<Upgrade> mAvailableUpgrades;
@@ -0,0 +1,99 @@
+#pragma once
+#include <vector>
+#include "../Math.h"
+#include "UIDrawList.h"
+
+// Per-instance data of an instanced sprite draw (world space, negative
+// size.x mirrors the quad)
+struct SpriteInstance
+{
+    Vector2 position;
+    Vector2 size;
+    float rotation;
+    Vector4 textureRect;
+    Vector3 color;
+};
+
+// Per-instance data of the ring shader (world space). The outline is
+// thickness pixels wide around radius; fill is the opacity of the inside.
+struct RingInstance
+{
+    Vector2 center;
+    float radius;
+    float thickness;
+    Vector3 color;
+    float fill;
+    float alpha;
+};
+
+// Everything drawn in one frame, recorded by the game thread and drawn by the
+// render thread. Only plain data and pointers to resources that outlive the
+// packet: textures live until shutdown and vertex arrays given to
+// Renderer::Release are deleted after the packet they were released in.
+struct FramePacket
+{
+    enum class CommandType
+    {
+        Sprites,    // sprites[first, first + count)
+        Instances,  // instances[first, first + count), one texture
+        Rings,      // rings[first, first + count)
+        Particles,  // particleVertices, count vertices from vertex first
+        Background, // texture repeated every size units, scrolled by cameraPos (screen quad)
+        Lines,      // vertices as a line loop
+        Triangles   // vertices as triangles
+    };
+
+    struct Sprite
+    {
+        class Texture* texture;
+        Vector2 position;   // Quad center in world space
+        Vector2 size;
+        float rotation;
+        Vector4 textureRect;
+        Vector3 color;
+        bool flip;
+        float textureFactor;
+    };
+
+    struct Command
+    {
+        CommandType type;
+        int first;
+        int count;
+        class Texture* texture;
+        class VertexArray* vertices;
+        Matrix4 model;
+        Vector3 color;
+        Vector2 cameraPos;
+        Vector2 size;
+        bool screenSpace;   // Lines, Triangles and Rings: drawn without the camera
+    };
+
+    // World to screen for the whole frame (see Renderer::SetCamera)
+    Matrix4 view;
+
+    std::vector<Command> commands;
+    std::vector<Sprite> sprites;
+    std::vector<SpriteInstance> instances;
+    std::vector<RingInstance> rings;
+    // x, y, r, g, b per vertex
+    std::vector<float> particleVertices;
+
+    // HUD and menus, drawn over the world
+    UIDrawList ui;
+
+    // Deleted by the render thread once this packet has been drawn
+    std::vector<class VertexArray*> released;
+
+    // Drops the recorded draws (but not the released arrays)
+    void Clear()
+    {
+        view = Matrix4::Identity;
+        commands.clear();
+        sprites.clear();
+        instances.clear();
+        rings.clear();
+        particleVertices.clear();
+        ui.Clear();
+    }
+};
@@ -0,0 +1,102 @@
+#include <GL/glew.h>
+#include "GLStateCache.h"
+#include "Shader.h"
+#include "Texture.h"
+#include "VertexArray.h"
+
+GLStateCache::GLStateCache()
+: mProgram(UNKNOWN)
+, mVertexArray(UNKNOWN)
+, mElementBuffer(UNKNOWN)
+, mTexture(UNKNOWN)
+, mBlend(UNKNOWN)
+{
+}
+
+void GLStateCache::InvalidateBindings()
+{
+    mProgram = UNKNOWN;
+    mVertexArray = UNKNOWN;
+    mElementBuffer = UNKNOWN;
+    mTexture = UNKNOWN;
+}
+
+bool GLStateCache::Change(unsigned int& current, unsigned int value)
+{
+    if (current == value)
+    {
+        mStats.skipped++;
+        return false;
+    }
+
+    current = value;
+    mStats.issued++;
+    return true;
+}
+
+void GLStateCache::UseProgram(Shader* shader)
+{
+    if (Change(mProgram, shader->GetProgram()))
+    {
+        glUseProgram(mProgram);
+    }
+}
+
+void GLStateCache::BindVertexArray(unsigned int vertexArray)
+{
+    if (Change(mVertexArray, vertexArray))
+    {
+        glBindVertexArray(vertexArray);
+        mElementBuffer = UNKNOWN;
+    }
+}
+
+void GLStateCache::BindVertexArray(VertexArray* vertices)
+{
+    if (!vertices->IsUploaded())
+    {
+        // Upload binds it; the name is new, so the bind below is issued
+        vertices->Upload();
+    }
+    BindVertexArray(vertices->GetID());
+}
+
+void GLStateCache::BindElementBuffer(unsigned int buffer)
+{
+    if (Change(mElementBuffer, buffer))
+    {
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
+    }
+}
+
+void GLStateCache::BindTexture(Texture* texture)
+{
+    if (texture->IsPending())
+    {
+        // Uploads and binds
+        texture->SetActive();
+        mTexture = texture->GetTextureID();
+        mStats.issued++;
+        return;
+    }
+
+    if (Change(mTexture, texture->GetTextureID()))
+    {
+        glBindTexture(GL_TEXTURE_2D, mTexture);
+    }
+}
+
+void GLStateCache::SetBlend(bool enabled)
+{
+    if (Change(mBlend, enabled ? 1u : 0u))
+    {
+        if (enabled)
+        {
+            glEnable(GL_BLEND);
+        }
+        else
+        {
+            glDisable(GL_BLEND);
+        }
+    }
+}
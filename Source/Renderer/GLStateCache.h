@@ -0,0 +1,46 @@
+#pragma once
+
+// Remembers the bound program, vertex array, element buffer and texture and
+// the blend switch, so binding what is already bound costs no GL call. Only
+// correct while every bind on the context goes through it; code that binds
+// directly (setup, uploads) must call InvalidateBindings afterwards.
+class GLStateCache
+{
+public:
+    struct Stats
+    {
+        int issued = 0;
+        int skipped = 0;
+    };
+
+    GLStateCache();
+
+    // Forgets the bound objects (not the blend switch)
+    void InvalidateBindings();
+
+    void UseProgram(class Shader* shader);
+    void BindVertexArray(unsigned int vertexArray);
+    // Uploads the vertex array first if needed
+    void BindVertexArray(class VertexArray* vertices);
+    // Part of the vertex array state; forgotten whenever the vertex array changes
+    void BindElementBuffer(unsigned int buffer);
+    // Uploads the texture (or its new wrap mode) first if needed
+    void BindTexture(class Texture* texture);
+    void SetBlend(bool enabled);
+
+    const Stats& GetStats() const { return mStats; }
+    void ResetStats() { mStats = Stats(); }
+
+private:
+    // True (and counted as issued) when value differs from current
+    bool Change(unsigned int& current, unsigned int value);
+
+    static const unsigned int UNKNOWN = ~0u;
+
+    unsigned int mProgram;
+    unsigned int mVertexArray;
+    unsigned int mElementBuffer;
+    unsigned int mTexture;
+    unsigned int mBlend;
+    Stats mStats;
+};
@@ -0,0 +1,43 @@
+#include <vector>
+#include "GeometryCache.h"
+#include "VertexArray.h"
+#include "../Math.h"
+
+GeometryCache::GeometryCache()
+{
+}
+
+GeometryCache::~GeometryCache()
+{
+}
+
+VertexArray* GeometryCache::GetCircle(int numPoints)
+{
+    auto iter = mCircles.find(numPoints);
+    if (iter != mCircles.end())
+    {
+        return iter->second;
+    }
+
+    // Drawn in order as a line loop, so no index buffer
+    std::vector<Vector2> vertices;
+    for (int i = 0; i < numPoints; ++i)
+    {
+        float angle = (Math::TwoPi / numPoints) * i;
+        vertices.emplace_back(Math::Cos(angle), Math::Sin(angle));
+    }
+
+    auto* circle = new VertexArray(vertices.data(), static_cast<unsigned int>(numPoints),
+                                   VertexArray::Layout::Pos2);
+    mCircles.emplace(numPoints, circle);
+    return circle;
+}
+
+void GeometryCache::Unload()
+{
+    for (auto& circle : mCircles)
+    {
+        delete circle.second;
+    }
+    mCircles.clear();
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include <unordered_map>
+
+// Unit shapes shared by every component that draws them, so spawning an
+// actor with an outline allocates no vertex buffers. Callers scale the shape
+// with their model matrix. Arrays are uploaded lazily (see VertexArray) and
+// live until Unload.
+class GeometryCache
+{
+public:
+    GeometryCache();
+    ~GeometryCache();
+
+    // Radius 1 circle through numPoints points, for line loops
+    class VertexArray* GetCircle(int numPoints);
+
+    void Unload();
+
+private:
+    // Keyed by number of points
+    std::unordered_map<int, class VertexArray*> mCircles;
+};
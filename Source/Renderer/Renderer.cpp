@@ -1,12 +1,48 @@
 
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
 #include <GL/glew.h>
 #include "Renderer.h"
 #include "Shader.h"
 #include "VertexArray.h"
 #include "Texture.h"
+#include "SpriteBatch.h"
+#include "UIDrawList.h"
 
 Renderer::Renderer(struct SDL_Window *window)
 : mBaseShader(nullptr)
+, mParticleShader(nullptr)
+, mSpriteShader(nullptr)
+, mInstanceShader(nullptr)
+, mBackgroundShader(nullptr)
+, mRingShader(nullptr)
+, mViewBuffer(0)
+, mViewBlockStride(0)
+, mScreenSpaceView(false)
+, mSpriteBatch(nullptr)
+, mUIVertexArray(0)
+, mUIVertexBuffer(0)
+, mUIIndexBuffer(0)
+, mUICapacity(0)
+, mRecordIndex(0)
+, mFramePending(false)
+, mStopRenderThread(false)
+, mSpriteVerts(nullptr)
+, mSpriteVertexArray(0)
+, mSpriteVertexBuffer(0)
+, mSpriteIndexBuffer(0)
+, mInstanceVertexArray(0)
+, mInstanceBuffer(0)
+, mInstanceBufferCapacity(0)
+, mRingVertexArray(0)
+, mRingBuffer(0)
+, mRingBufferCapacity(0)
+, mBackgroundVertexArray(0)
+, mBackgroundVertexBuffer(0)
+, mParticleVertexArray(0)
+, mParticleVertexBuffer(0)
+, mParticleBufferCapacity(0)
 , mWindow(window)
 , mContext(nullptr)
 {
@@ -52,109 +88,596 @@ bool Renderer::Initialize(float width, float height)
     glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
 
     // Enable alpha blending for textures
-    glEnable(GL_BLEND);
+    mState.SetBlend(true);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
     // Create orthographic projection matrix
     mOrthoProjection = Matrix4::CreateOrtho(0.0f, width, height, 0.0f, -1.0f, 1.0f);
-    mBaseShader->SetMatrixUniform("uOrthoProj", mOrthoProjection);
-    mBaseShader->SetActive();
-    
+
+    // World and screen views share one buffer; each slot starts on the
+    // alignment glBindBufferRange requires
+    GLint alignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    mViewBlockStride = static_cast<int>(sizeof(Matrix4));
+    if (alignment > 0) {
+        mViewBlockStride = (mViewBlockStride + alignment - 1) / alignment * alignment;
+    }
+    glGenBuffers(1, &mViewBuffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, mViewBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, 2 * mViewBlockStride, nullptr, GL_DYNAMIC_DRAW);
+    glBufferSubData(GL_UNIFORM_BUFFER, mViewBlockStride, sizeof(Matrix4), mOrthoProjection.GetAsFloatPtr());
+    glBindBufferRange(GL_UNIFORM_BUFFER, VIEW_BLOCK_BINDING, mViewBuffer, 0, sizeof(Matrix4));
+
+    for (Shader *shader : { mBaseShader, mParticleShader, mSpriteShader, mInstanceShader, mRingShader }) {
+        if (!shader->BindUniformBlock("ViewBlock", VIEW_BLOCK_BINDING)) {
+            SDL_Log("Shader has no ViewBlock uniform block.");
+            return false;
+        }
+    }
+
+    // Per-draw uniforms are set through cached handles
+    mBaseWorldTransform = mBaseShader->GetUniform("uWorldTransform");
+    mBaseColor = mBaseShader->GetUniform("uColor");
+    mBaseTexRect = mBaseShader->GetUniform("uTexRect");
+    mBaseTextureFactor = mBaseShader->GetUniform("uTextureFactor");
+    mBackgroundOrigin = mBackgroundShader->GetUniform("uOrigin");
+    mBackgroundTileSize = mBackgroundShader->GetUniform("uTileSize");
+
     // Set default uniform values
     mBaseShader->SetFloatUniform("uTextureFactor", 0.0f);
     mBaseShader->SetVectorUniform("uTexRect", Vector4(0.0f, 0.0f, 1.0f, 1.0f));
 
+    // The background is a screen quad and keeps its own projection
+    mBackgroundShader->SetActive();
+    mBackgroundShader->SetMatrixUniform("uOrthoProj", mOrthoProjection);
+    mBaseShader->SetActive();
+
     // Create sprite vertex array for texture rendering
     CreateSpriteVerts();
+    CreateParticleVerts();
+    CreateInstanceVerts();
+    CreateRingVerts();
+    mScreenSize = Vector2(width, height);
+    CreateBackgroundVerts(width, height);
+
+    mSpriteBatch = new SpriteBatch();
+    mSpriteBatch->Initialize(mSpriteShader, &mState);
+
+    // UI uses the same vertex format and shader as the sprite batch
+    glGenVertexArrays(1, &mUIVertexArray);
+    glBindVertexArray(mUIVertexArray);
+    glGenBuffers(1, &mUIVertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mUIVertexBuffer);
+    glGenBuffers(1, &mUIIndexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mUIIndexBuffer);
+
+    const GLsizei stride = UIDrawList::FLOATS_PER_VERTEX * sizeof(float);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride, (void*)0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, (void*)(2 * sizeof(float)));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, stride, (void*)(4 * sizeof(float)));
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, stride, (void*)(7 * sizeof(float)));
+
+    // Setup above bound things directly
+    mState.InvalidateBindings();
 
     return true;
 }
 
+bool Renderer::StartRenderThread()
+{
+    if (mRenderThread.joinable()) {
+        return true;
+    }
+
+    // A context is current on one thread at a time
+    if (SDL_GL_MakeCurrent(mWindow, nullptr) != 0) {
+        SDL_Log("Failed to release GL context: %s", SDL_GetError());
+        return false;
+    }
+
+    mStopRenderThread = false;
+    mRenderThread = std::thread(&Renderer::RenderThreadLoop, this);
+    return true;
+}
+
+void Renderer::StopRenderThread()
+{
+    if (!mRenderThread.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mFrameMutex);
+        mStopRenderThread = true;
+    }
+    mFrameReady.notify_one();
+    mRenderThread.join();
+
+    SDL_GL_MakeCurrent(mWindow, mContext);
+}
+
+void Renderer::RenderThreadLoop()
+{
+    SDL_GL_MakeCurrent(mWindow, mContext);
+
+    while (true) {
+        std::unique_lock<std::mutex> lock(mFrameMutex);
+        mFrameReady.wait(lock, [this] { return mFramePending || mStopRenderThread; });
+        if (!mFramePending) {
+            break;
+        }
+
+        // The game thread only touches the other packet until mFramePending is cleared
+        FramePacket &packet = mPackets[mRecordIndex ^ 1];
+        lock.unlock();
+
+        ExecutePacket(packet);
+
+        lock.lock();
+        mFramePending = false;
+        lock.unlock();
+        mFrameDone.notify_one();
+    }
+
+    SDL_GL_MakeCurrent(mWindow, nullptr);
+}
+
 void Renderer::Shutdown()
 {
+    StopRenderThread();
+
+    // Nothing draws them anymore
+    for (auto &packet : mPackets) {
+        for (auto *vertices : packet.released) {
+            delete vertices;
+        }
+        packet.released.clear();
+    }
+
     mBaseShader->Unload();
     delete mBaseShader;
+    mParticleShader->Unload();
+    delete mParticleShader;
+    mSpriteShader->Unload();
+    delete mSpriteShader;
+    mInstanceShader->Unload();
+    delete mInstanceShader;
+    mBackgroundShader->Unload();
+    delete mBackgroundShader;
+    mRingShader->Unload();
+    delete mRingShader;
+
+    mSpriteBatch->Shutdown();
+    delete mSpriteBatch;
+    mSpriteBatch = nullptr;
+
+    glDeleteBuffers(1, &mUIVertexBuffer);
+    glDeleteBuffers(1, &mUIIndexBuffer);
+    glDeleteVertexArrays(1, &mUIVertexArray);
+
+    mSpriteAtlas.Unload();
+    mGeometry.Unload();
+
+    glDeleteBuffers(1, &mViewBuffer);
+
+    glDeleteBuffers(1, &mParticleVertexBuffer);
+    glDeleteVertexArrays(1, &mParticleVertexArray);
+    glDeleteBuffers(1, &mInstanceBuffer);
+    glDeleteVertexArrays(1, &mInstanceVertexArray);
+    glDeleteBuffers(1, &mRingBuffer);
+    glDeleteVertexArrays(1, &mRingVertexArray);
+    glDeleteBuffers(1, &mBackgroundVertexBuffer);
+    glDeleteVertexArrays(1, &mBackgroundVertexArray);
 
     SDL_GL_DeleteContext(mContext);
     SDL_DestroyWindow(mWindow);
 }
 
 void Renderer::Clear()
+{
+    // Draws recorded before the frame started (e.g. floating text during
+    // updates) are dropped, just as immediate draws before the clear were
+    mPackets[mRecordIndex].Clear();
+}
+
+FramePacket::Command &Renderer::AddCommand(FramePacket::CommandType type)
+{
+    FramePacket::Command command{};
+    command.type = type;
+    auto &commands = mPackets[mRecordIndex].commands;
+    commands.emplace_back(command);
+    return commands.back();
+}
+
+void Renderer::SetCamera(const Vector2 &cameraPos)
+{
+    Vector2 cameraOffset = mScreenSize * 0.5f - cameraPos;
+    mPackets[mRecordIndex].view = Matrix4::CreateTranslation(Vector3(cameraOffset.x, cameraOffset.y, 0.0f));
+}
+
+void Renderer::Draw(const class Matrix4 &modelMatrix, VertexArray* vertices, class Vector3 color, bool screenSpace)
+{
+    FramePacket::Command &command = AddCommand(FramePacket::CommandType::Lines);
+    command.vertices = vertices;
+    command.model = modelMatrix;
+    command.color = color;
+    command.screenSpace = screenSpace;
+}
+
+void Renderer::DrawFilled(const class Matrix4 &modelMatrix, VertexArray* vertices, class Vector3 color, bool screenSpace)
+{
+    FramePacket::Command &command = AddCommand(FramePacket::CommandType::Triangles);
+    command.vertices = vertices;
+    command.model = modelMatrix;
+    command.color = color;
+    command.screenSpace = screenSpace;
+}
+
+void Renderer::DrawTexture(const Vector2 &position, const Vector2 &size, float rotation, const Vector3 &color,
+                           Texture *texture, const Vector4 &textureRect, bool flip, float textureFactor) {
+    // Consecutive sprites share a command; the batch splits them by texture
+    FramePacket &packet = mPackets[mRecordIndex];
+    if (packet.commands.empty() || packet.commands.back().type != FramePacket::CommandType::Sprites) {
+        AddCommand(FramePacket::CommandType::Sprites).first = static_cast<int>(packet.sprites.size());
+    }
+    packet.commands.back().count++;
+    packet.sprites.push_back({ texture, position, size, rotation, textureRect, color, flip, textureFactor });
+}
+
+void Renderer::DrawParticles(const float *vertices, int numVertices)
+{
+    if (numVertices <= 0) {
+        return;
+    }
+
+    auto &particleVertices = mPackets[mRecordIndex].particleVertices;
+    FramePacket::Command &command = AddCommand(FramePacket::CommandType::Particles);
+    command.first = static_cast<int>(particleVertices.size() / 5);
+    command.count = numVertices;
+    particleVertices.insert(particleVertices.end(), vertices, vertices + numVertices * 5);
+}
+
+void Renderer::DrawSpriteInstances(Texture *texture, const SpriteInstance *instances, int count)
+{
+    if (!texture || count <= 0) {
+        return;
+    }
+
+    auto &packetInstances = mPackets[mRecordIndex].instances;
+    FramePacket::Command &command = AddCommand(FramePacket::CommandType::Instances);
+    command.first = static_cast<int>(packetInstances.size());
+    command.count = count;
+    command.texture = texture;
+    packetInstances.insert(packetInstances.end(), instances, instances + count);
+}
+
+void Renderer::DrawRing(const RingInstance &ring, bool screenSpace)
+{
+    FramePacket &packet = mPackets[mRecordIndex];
+    if (packet.commands.empty() || packet.commands.back().type != FramePacket::CommandType::Rings ||
+        packet.commands.back().screenSpace != screenSpace) {
+        FramePacket::Command &command = AddCommand(FramePacket::CommandType::Rings);
+        command.first = static_cast<int>(packet.rings.size());
+        command.screenSpace = screenSpace;
+    }
+    packet.commands.back().count++;
+    packet.rings.emplace_back(ring);
+}
+
+void Renderer::DrawBackground(Texture *texture, const Vector2 &tileSize, const Vector2 &cameraPos, float parallax)
+{
+    if (!texture || tileSize.x <= 0.0f || tileSize.y <= 0.0f) {
+        return;
+    }
+
+    FramePacket::Command &command = AddCommand(FramePacket::CommandType::Background);
+    command.texture = texture;
+    command.cameraPos = cameraPos * parallax;
+    command.size = tileSize;
+}
+
+void Renderer::Present()
+{
+    if (!mRenderThread.joinable()) {
+        ExecutePacket(mPackets[mRecordIndex]);
+        return;
+    }
+
+    // Only blocks when the render thread is still drawing the previous frame
+    {
+        std::unique_lock<std::mutex> lock(mFrameMutex);
+        mFrameDone.wait(lock, [this] { return !mFramePending; });
+        mRecordIndex ^= 1;
+        mFramePending = true;
+    }
+    mFrameReady.notify_one();
+}
+
+GLStateCache::Stats Renderer::GetBindStats()
+{
+    std::lock_guard<std::mutex> lock(mFrameMutex);
+    return mBindStats;
+}
+
+void Renderer::Release(VertexArray *vertices)
+{
+    if (vertices) {
+        mPackets[mRecordIndex].released.emplace_back(vertices);
+    }
+}
+
+void Renderer::ExecutePacket(FramePacket &packet)
 {
     // Clear the color buffer
     glClear(GL_COLOR_BUFFER_BIT);
+
+    // The only camera upload of the frame
+    Matrix4 viewProj = packet.view * mOrthoProjection;
+    glBindBuffer(GL_UNIFORM_BUFFER, mViewBuffer);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(Matrix4), viewProj.GetAsFloatPtr());
+    mScreenSpaceView = true;
+    UseView(false);
+
+    for (const auto &command : packet.commands) {
+        switch (command.type) {
+            case FramePacket::CommandType::Sprites:
+                UseView(false);
+                for (int i = command.first; i < command.first + command.count; ++i) {
+                    const FramePacket::Sprite &sprite = packet.sprites[i];
+                    if (sprite.texture) {
+                        mSpriteBatch->Draw(sprite.texture, sprite.position, sprite.size, sprite.rotation,
+                                           sprite.textureRect, sprite.color, sprite.flip, sprite.textureFactor);
+                    } else {
+                        float flipFactor = sprite.flip ? -1.0f : 1.0f;
+                        Matrix4 model = Matrix4::CreateScale(Vector3(sprite.size.x * flipFactor, sprite.size.y, 1.0f)) *
+                                        Matrix4::CreateRotationZ(sprite.rotation) *
+                                        Matrix4::CreateTranslation(Vector3(sprite.position.x, sprite.position.y, 0.0f));
+                        Draw(RendererMode::TRIANGLES, model, mSpriteVerts, sprite.color);
+                    }
+                }
+                break;
+            case FramePacket::CommandType::Instances:
+                ExecuteInstances(packet, command);
+                break;
+            case FramePacket::CommandType::Particles:
+                ExecuteParticles(packet, command);
+                break;
+            case FramePacket::CommandType::Rings:
+                ExecuteRings(packet, command);
+                break;
+            case FramePacket::CommandType::Background:
+                ExecuteBackground(command);
+                break;
+            case FramePacket::CommandType::Lines:
+            case FramePacket::CommandType::Triangles:
+                ExecuteGeometry(command);
+                break;
+        }
+    }
+
+    FlushSprites();
+    ExecuteUI(packet.ui);
+
+    // Swap the buffers
+    SDL_GL_SwapWindow(mWindow);
+
+    // This was the last packet that could draw them
+    if (!packet.released.empty()) {
+        for (auto *vertices : packet.released) {
+            delete vertices;
+        }
+        packet.released.clear();
+
+        // Deleted names may be reused by the next vertex array
+        mState.InvalidateBindings();
+    }
+
+    std::lock_guard<std::mutex> lock(mFrameMutex);
+    mBindStats = mState.GetStats();
+    mState.ResetStats();
 }
 
-void Renderer::Draw(const class Matrix4 &modelMatrix, VertexArray* vertices, class Vector3 color)
+void Renderer::ExecuteGeometry(const FramePacket::Command &command)
 {
-    mBaseShader->SetActive();
-    mBaseShader->SetMatrixUniform("uWorldTransform", modelMatrix);
-    mBaseShader->SetVectorUniform("uColor", color);
-    mBaseShader->SetFloatUniform("uTextureFactor", 0.0f);
-
-    vertices->SetActive();
-    glDrawElements(GL_LINE_LOOP, vertices->GetNumIndices(), GL_UNSIGNED_INT,nullptr);
+    FlushSprites();
+    UseView(command.screenSpace);
+    mState.UseProgram(mBaseShader);
+    mBaseShader->SetMatrixUniform(mBaseWorldTransform, command.model);
+    mBaseShader->SetVectorUniform(mBaseColor, command.color);
+    mBaseShader->SetFloatUniform(mBaseTextureFactor, 0.0f);
+
+    mState.BindVertexArray(command.vertices);
+    command.vertices->Draw(command.type == FramePacket::CommandType::Lines ? GL_LINE_LOOP : GL_TRIANGLES);
 }
 
-void Renderer::Draw(RendererMode mode, const Matrix4 &modelMatrix, const Vector2 &cameraPos, VertexArray *vertices,
+void Renderer::Draw(RendererMode mode, const Matrix4 &modelMatrix, VertexArray *vertices,
                     const Vector3 &color, Texture *texture, const Vector4 &textureRect, float textureFactor) {
-    mBaseShader->SetActive();
-    mBaseShader->SetMatrixUniform("uWorldTransform", modelMatrix);
-    mBaseShader->SetVectorUniform("uColor", color);
-    mBaseShader->SetVectorUniform("uTexRect", textureRect);
+    FlushSprites();
+    mState.UseProgram(mBaseShader);
+    mBaseShader->SetMatrixUniform(mBaseWorldTransform, modelMatrix);
+    mBaseShader->SetVectorUniform(mBaseColor, color);
+    mBaseShader->SetVectorUniform(mBaseTexRect, textureRect);
 
     if (texture) {
         // Use sprite vertex array with texture coordinates for textured rendering
-        glBindVertexArray(mSpriteVertexArray);
-        texture->SetActive();
-        mBaseShader->SetFloatUniform("uTextureFactor", textureFactor);
+        mState.BindVertexArray(mSpriteVertexArray);
+        mState.BindTexture(texture);
+        mBaseShader->SetFloatUniform(mBaseTextureFactor, textureFactor);
         glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
     } else {
         // Use provided vertices for non-textured rendering
-        mBaseShader->SetFloatUniform("uTextureFactor", 0.0f);
+        mBaseShader->SetFloatUniform(mBaseTextureFactor, 0.0f);
         if (vertices) {
-            vertices->SetActive();
+            mState.BindVertexArray(vertices);
             if (mode == RendererMode::LINES) {
-                glDrawElements(GL_LINE_LOOP, vertices->GetNumIndices(), GL_UNSIGNED_INT, nullptr);
+                vertices->Draw(GL_LINE_LOOP);
             } else if (mode == RendererMode::TRIANGLES) {
-                glDrawElements(GL_TRIANGLES, vertices->GetNumIndices(), GL_UNSIGNED_INT, nullptr);
+                vertices->Draw(GL_TRIANGLES);
             }
         }
     }
 }
 
-void Renderer::DrawTexture(const Vector2 &position, const Vector2 &size, float rotation, const Vector3 &color,
-                           Texture *texture, const Vector4 &textureRect, const Vector2 &cameraPos, bool flip,
-                           float textureFactor) {
-    float flipFactor = flip ? -1.0f : 1.0f;
+void Renderer::ExecuteParticles(const FramePacket &packet, const FramePacket::Command &command)
+{
+    FlushSprites();
+    UseView(false);
 
-    // Apply camera offset to position
-    Vector2 screenCenter(1024.0f / 2.0f, 768.0f / 2.0f); // WINDOW_WIDTH and WINDOW_HEIGHT
-    Vector2 cameraOffset = screenCenter - cameraPos;
-    Vector2 finalPos = position + cameraOffset;
+    const float *vertices = &packet.particleVertices[static_cast<size_t>(command.first) * 5];
+    const int numVertices = command.count;
 
-    Matrix4 model = Matrix4::CreateScale(Vector3(size.x * flipFactor, size.y, 1.0f)) *
-                    Matrix4::CreateRotationZ(rotation) *
-                    Matrix4::CreateTranslation(Vector3(finalPos.x, finalPos.y, 0.0f));
+    mState.UseProgram(mParticleShader);
 
-    Draw(RendererMode::TRIANGLES, model, cameraPos, mSpriteVerts, color, texture, textureRect, textureFactor);
+    mState.BindVertexArray(mParticleVertexArray);
+    glBindBuffer(GL_ARRAY_BUFFER, mParticleVertexBuffer);
+
+    GLsizeiptr bytes = static_cast<GLsizeiptr>(numVertices) * 5 * sizeof(float);
+    if (numVertices > mParticleBufferCapacity) {
+        mParticleBufferCapacity = numVertices;
+        glBufferData(GL_ARRAY_BUFFER, bytes, vertices, GL_DYNAMIC_DRAW);
+    } else {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, vertices);
+    }
+
+    glDrawArrays(GL_TRIANGLES, 0, numVertices);
 }
 
-void Renderer::DrawFilled(const class Matrix4 &modelMatrix, VertexArray* vertices, class Vector3 color)
+void Renderer::ExecuteInstances(const FramePacket &packet, const FramePacket::Command &command)
 {
-    mBaseShader->SetActive();
-    mBaseShader->SetMatrixUniform("uWorldTransform", modelMatrix);
-    mBaseShader->SetVectorUniform("uColor", color);
-    mBaseShader->SetFloatUniform("uTextureFactor", 0.0f);
+    FlushSprites();
+    UseView(false);
+
+    Texture *texture = command.texture;
+    const SpriteInstance *instances = &packet.instances[command.first];
+    const int count = command.count;
+
+    mState.UseProgram(mInstanceShader);
+    mState.BindTexture(texture);
+
+    mState.BindVertexArray(mInstanceVertexArray);
+    glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
 
-    vertices->SetActive();
-    glDrawElements(GL_TRIANGLES, vertices->GetNumIndices(), GL_UNSIGNED_INT,nullptr);
+    GLsizeiptr bytes = static_cast<GLsizeiptr>(count) * sizeof(SpriteInstance);
+    if (count > mInstanceBufferCapacity) {
+        mInstanceBufferCapacity = count;
+        glBufferData(GL_ARRAY_BUFFER, bytes, instances, GL_DYNAMIC_DRAW);
+    } else {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, instances);
+    }
+
+    glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr, count);
 }
 
-void Renderer::Present()
+void Renderer::ExecuteRings(const FramePacket &packet, const FramePacket::Command &command)
 {
-    // Swap the buffers
-    SDL_GL_SwapWindow(mWindow);
+    FlushSprites();
+    UseView(command.screenSpace);
+
+    mState.UseProgram(mRingShader);
+
+    mState.BindVertexArray(mRingVertexArray);
+    glBindBuffer(GL_ARRAY_BUFFER, mRingBuffer);
+
+    const RingInstance *rings = &packet.rings[command.first];
+    GLsizeiptr bytes = static_cast<GLsizeiptr>(command.count) * sizeof(RingInstance);
+    if (command.count > mRingBufferCapacity) {
+        mRingBufferCapacity = command.count;
+        glBufferData(GL_ARRAY_BUFFER, bytes, rings, GL_DYNAMIC_DRAW);
+    } else {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, rings);
+    }
+
+    glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr, command.count);
+}
+
+void Renderer::ExecuteBackground(const FramePacket::Command &command)
+{
+    FlushSprites();
+
+    mState.UseProgram(mBackgroundShader);
+    mBackgroundShader->SetVectorUniform(mBackgroundOrigin, command.cameraPos - mScreenSize * 0.5f);
+    mBackgroundShader->SetVectorUniform(mBackgroundTileSize, command.size);
+    // Wrap mode is render thread state, so it is set here rather than by the caller
+    command.texture->SetRepeat(true);
+    mState.BindTexture(command.texture);
+
+    mState.BindVertexArray(mBackgroundVertexArray);
+    glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+}
+
+void Renderer::ExecuteUI(const UIDrawList &ui)
+{
+    const int numQuads = ui.GetNumQuads();
+    if (numQuads == 0) {
+        return;
+    }
+
+    // Same sprite shader as the world, through the screen-space view
+    UseView(true);
+
+    mState.BindVertexArray(mUIVertexArray);
+    glBindBuffer(GL_ARRAY_BUFFER, mUIVertexBuffer);
+
+    // Grow by doubling; indices only change when the capacity does
+    if (numQuads > mUICapacity) {
+        int capacity = mUICapacity > 0 ? mUICapacity : 256;
+        while (capacity < numQuads) {
+            capacity *= 2;
+        }
+
+        std::vector<unsigned int> indices(capacity * 6);
+        for (unsigned int i = 0; i < static_cast<unsigned int>(capacity); ++i) {
+            unsigned int v = i * 4;
+            indices[i * 6 + 0] = v + 0;
+            indices[i * 6 + 1] = v + 1;
+            indices[i * 6 + 2] = v + 2;
+            indices[i * 6 + 3] = v + 2;
+            indices[i * 6 + 4] = v + 3;
+            indices[i * 6 + 5] = v + 0;
+        }
+        mState.BindElementBuffer(mUIIndexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+        glBufferData(GL_ARRAY_BUFFER, capacity * 4 * UIDrawList::FLOATS_PER_VERTEX * sizeof(float), nullptr,
+                     GL_STREAM_DRAW);
+        mUICapacity = capacity;
+    }
+
+    // One upload for the whole frame
+    const std::vector<float> &vertices = ui.GetVertices();
+    glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(float), vertices.data());
+
+    mState.UseProgram(mSpriteShader);
+    for (const auto &command : ui.GetCommands()) {
+        if (command.texture) {
+            mState.BindTexture(command.texture);
+        }
+        glDrawElements(GL_TRIANGLES, command.numQuads * 6, GL_UNSIGNED_INT,
+                       (void*)(static_cast<size_t>(command.firstQuad) * 6 * sizeof(unsigned int)));
+    }
+}
+
+void Renderer::FlushSprites()
+{
+    if (mSpriteBatch) {
+        mSpriteBatch->Flush();
+    }
+}
+
+void Renderer::UseView(bool screenSpace)
+{
+    if (screenSpace == mScreenSpaceView) {
+        return;
+    }
+
+    // Queued sprites belong to the previous view
+    FlushSprites();
+    mScreenSpaceView = screenSpace;
+    glBindBufferRange(GL_UNIFORM_BUFFER, VIEW_BLOCK_BINDING, mViewBuffer, screenSpace ? mViewBlockStride : 0,
+                      sizeof(Matrix4));
 }
 
 Texture *Renderer::GetTexture(const std::string &fileName) {
@@ -175,6 +698,41 @@ Texture *Renderer::GetTexture(const std::string &fileName) {
     return tex;
 }
 
+bool Renderer::LoadSpriteAtlas(const std::string &directory, const std::vector<std::string> &skipFolders)
+{
+    namespace fs = std::filesystem;
+
+    std::error_code error;
+    if (!fs::is_directory(directory, error)) {
+        SDL_Log("Sprite directory not found: %s", directory.c_str());
+        return false;
+    }
+
+    std::vector<std::string> fileNames;
+    for (const auto &folder : fs::directory_iterator(directory, error)) {
+        std::string folderName = folder.path().filename().string();
+        if (!folder.is_directory() ||
+            std::find(skipFolders.begin(), skipFolders.end(), folderName) != skipFolders.end()) {
+            continue;
+        }
+
+        for (const auto &file : fs::directory_iterator(folder.path(), error)) {
+            if (file.path().extension() == ".png") {
+                // Same spelling as the paths actors pass to GetTexture
+                fileNames.emplace_back(directory + "/" + folderName + "/" + file.path().filename().string());
+            }
+        }
+    }
+
+    // Directory order is unspecified; keep the layout stable between runs
+    std::sort(fileNames.begin(), fileNames.end());
+    return mSpriteAtlas.Build(fileNames);
+}
+
+const TextureAtlas::Region *Renderer::GetAtlasRegion(const std::string &fileName) const
+{
+    return mSpriteAtlas.GetRegion(fileName);
+}
 
 bool Renderer::LoadShaders()
 {
@@ -182,16 +740,16 @@ bool Renderer::LoadShaders()
     mBaseShader = new Shader();
     
     // Try different paths for shaders
-    std::string shaderPath = "Shaders/Base";
-    if (!mBaseShader->Load(shaderPath))
+    mShaderPath = "Shaders/";
+    if (!mBaseShader->Load(mShaderPath + "Base"))
     {
         // Try from parent directory
-        shaderPath = "../Shaders/Base";
-        if (!mBaseShader->Load(shaderPath))
+        mShaderPath = "../Shaders/";
+        if (!mBaseShader->Load(mShaderPath + "Base"))
         {
             // Try from build directory
-            shaderPath = "../../Shaders/Base";
-            if (!mBaseShader->Load(shaderPath))
+            mShaderPath = "../../Shaders/";
+            if (!mBaseShader->Load(mShaderPath + "Base"))
             {
                 SDL_Log("Failed to load shaders from all paths.");
                 return false;
@@ -199,6 +757,42 @@ bool Renderer::LoadShaders()
         }
     }
 
+    // Other shaders live next to Base
+    mParticleShader = new Shader();
+    if (!mParticleShader->Load(mShaderPath + "Particle"))
+    {
+        SDL_Log("Failed to load particle shader.");
+        return false;
+    }
+
+    mSpriteShader = new Shader();
+    if (!mSpriteShader->Load(mShaderPath + "Sprite"))
+    {
+        SDL_Log("Failed to load sprite shader.");
+        return false;
+    }
+
+    mInstanceShader = new Shader();
+    if (!mInstanceShader->Load(mShaderPath + "SpriteInstanced"))
+    {
+        SDL_Log("Failed to load instanced sprite shader.");
+        return false;
+    }
+
+    mRingShader = new Shader();
+    if (!mRingShader->Load(mShaderPath + "Ring"))
+    {
+        SDL_Log("Failed to load ring shader.");
+        return false;
+    }
+
+    mBackgroundShader = new Shader();
+    if (!mBackgroundShader->Load(mShaderPath + "Background"))
+    {
+        SDL_Log("Failed to load background shader.");
+        return false;
+    }
+
     mBaseShader->SetActive();
 
     return true;
@@ -225,15 +819,13 @@ void Renderer::CreateSpriteVerts()
     glBindVertexArray(mSpriteVertexArray);
 
     // Create and bind vertex buffer
-    unsigned int vertexBuffer;
-    glGenBuffers(1, &vertexBuffer);
-    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    glGenBuffers(1, &mSpriteVertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mSpriteVertexBuffer);
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
     // Create and bind index buffer
-    unsigned int indexBuffer;
-    glGenBuffers(1, &indexBuffer);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+    glGenBuffers(1, &mSpriteIndexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mSpriteIndexBuffer);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
 
     // Position attribute (location = 0)
@@ -245,5 +837,120 @@ void Renderer::CreateSpriteVerts()
     glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
 
     // Create a simple VertexArray wrapper (we'll use the raw GL objects above)
-    mSpriteVerts = new VertexArray(vertices, 4, indices, 6);
+    mSpriteVerts = new VertexArray(vertices, 4, VertexArray::Layout::Pos3Tex2, indices, 6);
+}
+
+void Renderer::CreateParticleVerts()
+{
+    // Format: x, y, r, g, b (data is uploaded by DrawParticles)
+    glGenVertexArrays(1, &mParticleVertexArray);
+    glBindVertexArray(mParticleVertexArray);
+
+    glGenBuffers(1, &mParticleVertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mParticleVertexBuffer);
+
+    // Position attribute (location = 0)
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+
+    // Color attribute (location = 1)
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(2 * sizeof(float)));
+}
+
+void Renderer::CreateInstanceVerts()
+{
+    // Reuses the sprite quad buffers; only the instance buffer is new
+    glGenVertexArrays(1, &mInstanceVertexArray);
+    glBindVertexArray(mInstanceVertexArray);
+
+    glBindBuffer(GL_ARRAY_BUFFER, mSpriteVertexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mSpriteIndexBuffer);
+
+    // Position attribute (location = 0)
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+
+    // Texture coordinate attribute (location = 1)
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
+
+    // One SpriteInstance per instance (data is uploaded by DrawSpriteInstances)
+    glGenBuffers(1, &mInstanceBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
+
+    const GLsizei stride = sizeof(SpriteInstance);
+    struct Attribute { GLint size; size_t offset; };
+    const Attribute attributes[] = {
+        { 2, offsetof(SpriteInstance, position) },    // location = 2
+        { 2, offsetof(SpriteInstance, size) },        // location = 3
+        { 1, offsetof(SpriteInstance, rotation) },    // location = 4
+        { 4, offsetof(SpriteInstance, textureRect) }, // location = 5
+        { 3, offsetof(SpriteInstance, color) }        // location = 6
+    };
+
+    GLuint location = 2;
+    for (const auto &attribute : attributes) {
+        glEnableVertexAttribArray(location);
+        glVertexAttribPointer(location, attribute.size, GL_FLOAT, GL_FALSE, stride, (void*)attribute.offset);
+        glVertexAttribDivisor(location, 1);
+        location++;
+    }
+}
+
+void Renderer::CreateBackgroundVerts(float width, float height)
+{
+    // Format: x, y in screen pixels, drawn as a triangle fan
+    float vertices[] = {
+        0.0f,  0.0f,
+        width, 0.0f,
+        width, height,
+        0.0f,  height
+    };
+
+    glGenVertexArrays(1, &mBackgroundVertexArray);
+    glBindVertexArray(mBackgroundVertexArray);
+
+    glGenBuffers(1, &mBackgroundVertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mBackgroundVertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+    // Position attribute (location = 0)
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+}
+
+void Renderer::CreateRingVerts()
+{
+    // Reuses the sprite quad buffers; only the instance buffer is new
+    glGenVertexArrays(1, &mRingVertexArray);
+    glBindVertexArray(mRingVertexArray);
+
+    glBindBuffer(GL_ARRAY_BUFFER, mSpriteVertexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mSpriteIndexBuffer);
+
+    // Position attribute (location = 0)
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+
+    // One RingInstance per instance (data is uploaded by ExecuteRings)
+    glGenBuffers(1, &mRingBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mRingBuffer);
+
+    const GLsizei stride = sizeof(RingInstance);
+    struct Attribute { GLint size; size_t offset; };
+    const Attribute attributes[] = {
+        { 2, offsetof(RingInstance, center) },  // location = 1
+        { 2, offsetof(RingInstance, radius) },  // location = 2 (radius, thickness)
+        { 3, offsetof(RingInstance, color) },   // location = 3
+        { 2, offsetof(RingInstance, fill) }     // location = 4 (fill, alpha)
+    };
+
+    GLuint location = 1;
+    for (const auto &attribute : attributes) {
+        glEnableVertexAttribArray(location);
+        glVertexAttribPointer(location, attribute.size, GL_FLOAT, GL_FALSE, stride, (void*)attribute.offset);
+        glVertexAttribDivisor(location, 1);
+        location++;
+    }
 }
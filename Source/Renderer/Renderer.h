@@ -1,11 +1,19 @@
 #pragma once
+#include <condition_variable>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 #include <SDL.h>
 #include "../Math.h"
 #include "VertexArray.h"
 #include "Texture.h"
+#include "Shader.h"
+#include "TextureAtlas.h"
+#include "FramePacket.h"
+#include "GLStateCache.h"
+#include "GeometryCache.h"
 
 
 enum class RendererMode {
@@ -13,6 +21,10 @@ enum class RendererMode {
     LINES
 };
 
+// Draw calls made on the game thread are recorded into a FramePacket; Present
+// hands it to the render thread, which owns the GL context and draws it while
+// the game records the next one into the other packet. Without a render
+// thread (StartRenderThread not called) Present draws the packet itself.
 class Renderer
 {
 public:
@@ -22,45 +34,173 @@ public:
 	bool Initialize(float width, float height);
 	void Shutdown();
 
-	void Clear();
-	void Draw(const Matrix4 &modelMatrix, VertexArray* vertices, Vector3 color);
-	void DrawFilled(const Matrix4 &modelMatrix, VertexArray* vertices, Vector3 color);
-    void DrawRect(const Vector2 &position, const Vector2 &size, float rotation,
-              const Vector3 &color, const Vector2 &cameraPos, RendererMode mode);
-	void DrawWithCamera(const Matrix4 &modelMatrix, VertexArray* vertices, Vector3 color, const Vector2& cameraOffset);
+    // Moves the GL context to a new render thread; call after Initialize
+    bool StartRenderThread();
+    // Waits for the last frame, ends the thread and takes the context back
+    void StopRenderThread();
+
+    // Centers the camera on cameraPos for the world draws of this frame.
+    // The view is uploaded once per frame; world draws only carry model data.
+    // Until it is called (e.g. in menus) world space is screen space.
+    void SetCamera(const Vector2 &cameraPos);
+
+    // Models are in world space; screenSpace ones ignore the camera
+	void Draw(const Matrix4 &modelMatrix, VertexArray* vertices, Vector3 color, bool screenSpace = false);
+	void DrawFilled(const Matrix4 &modelMatrix, VertexArray* vertices, Vector3 color, bool screenSpace = false);
     void DrawTexture(const Vector2 &position, const Vector2 &size, float rotation,
                  const Vector3 &color, Texture *texture,
-                 const Vector4 &textureRect = Vector4::UnitRect,
-                 const Vector2 &cameraPos = Vector2::Zero, bool flip = false,
+                 const Vector4 &textureRect = Vector4::UnitRect, bool flip = false,
                  float textureFactor = 1.0f);
 
-    void DrawGeometry(const Vector2 &position, const Vector2 &size, float rotation,
-                      const Vector3 &color, const Vector2 &cameraPos, VertexArray *vertexArray, RendererMode mode);
+    // Draws world-space triangles (x, y, r, g, b per vertex) in a single call
+    void DrawParticles(const float *vertices, int numVertices);
+
+    // Draws every instance with the sprite quad and one texture in a single call
+    void DrawSpriteInstances(Texture *texture, const SpriteInstance *instances, int count);
+
+    // Consecutive rings in the same space are drawn in one instanced call
+    void DrawRing(const RingInstance &ring, bool screenSpace = false);
 
+    // Fills the screen with texture repeated every tileSize world units, in
+    // one quad. The layer scrolls at parallax times the camera speed. The
+    // texture is switched to GL_REPEAT when the command is drawn.
+    void DrawBackground(Texture *texture, const Vector2 &tileSize, const Vector2 &cameraPos, float parallax = 1.0f);
+
+	// Starts recording a new frame
+	void Clear();
+	// Submits the recorded frame, waiting only if the previous one is still being drawn
 	void Present();
 
+    // Deletes vertices once no recorded frame can still draw them
+    void Release(class VertexArray *vertices);
+
+    // Program/vertex array/texture binds issued and skipped while drawing the last frame
+    GLStateCache::Stats GetBindStats();
+
 	// Getters
 	class Shader* GetBaseShader() const { return mBaseShader; }
+    // HUD and menus record here; drawn over everything else
+    class UIDrawList *GetUIDrawList() { return &mPackets[mRecordIndex].ui; }
     class Texture *GetTexture(const std::string &fileName);
 
+    // Packs every <directory>/<folder>/*.png into the sprite atlas, except
+    // the folders listed in skipFolders
+    bool LoadSpriteAtlas(const std::string &directory, const std::vector<std::string> &skipFolders);
+    // Null if fileName (same path given to GetTexture) is not in the atlas
+    const TextureAtlas::Region *GetAtlasRegion(const std::string &fileName) const;
+
+    // Shared unit shapes for DrawComponents and debug drawing
+    GeometryCache *GetGeometry() { return &mGeometry; }
+
 private:
-    void Draw(RendererMode mode, const Matrix4 &modelMatrix, const Vector2 &cameraPos, VertexArray *vertices,
+    FramePacket::Command &AddCommand(FramePacket::CommandType type);
+
+    // Render thread side: everything below issues GL calls
+    void Draw(RendererMode mode, const Matrix4 &modelMatrix, VertexArray *vertices,
           const Vector3 &color, Texture *texture = nullptr, const Vector4 &textureRect = Vector4::UnitRect,
           float textureFactor = 1.0f);
+    void RenderThreadLoop();
+    void ExecutePacket(FramePacket &packet);
+    void ExecuteGeometry(const FramePacket::Command &command);
+    void ExecuteParticles(const FramePacket &packet, const FramePacket::Command &command);
+    void ExecuteInstances(const FramePacket &packet, const FramePacket::Command &command);
+    void ExecuteBackground(const FramePacket::Command &command);
+    void ExecuteRings(const FramePacket &packet, const FramePacket::Command &command);
+    void ExecuteUI(const UIDrawList &ui);
+    // Draws the sprites queued in the sprite batch; every other draw flushes first
+    void FlushSprites();
+    // Points the view block at the world or the screen-space view
+    void UseView(bool screenSpace);
 
 	bool LoadShaders();
 
     void CreateSpriteVerts();
+    void CreateParticleVerts();
+    void CreateInstanceVerts();
+    void CreateBackgroundVerts(float width, float height);
+    void CreateRingVerts();
 
 	// Game
 	class Game* mGame;
 
 	// Sprite shader
 	class Shader* mBaseShader;
+	class Shader* mParticleShader;
+	class Shader* mSpriteShader;
+	class Shader* mInstanceShader;
+	class Shader* mBackgroundShader;
+	class Shader* mRingShader;
+
+    // Uniforms set on every draw
+    UniformHandle mBaseWorldTransform;
+    UniformHandle mBaseColor;
+    UniformHandle mBaseTexRect;
+    UniformHandle mBaseTextureFactor;
+    UniformHandle mBackgroundOrigin;
+    UniformHandle mBackgroundTileSize;
+
+    // Uniform buffer behind the ViewBlock of every world shader: the world
+    // view-projection (rewritten each frame) at 0 and the screen-space one
+    // (fixed) at mViewBlockStride
+    static const unsigned int VIEW_BLOCK_BINDING = 0;
+    unsigned int mViewBuffer;
+    int mViewBlockStride;
+    bool mScreenSpaceView;
+
+    // Every bind while drawing goes through here
+    GLStateCache mState;
+    // Copied from mState after each frame (guarded by mFrameMutex)
+    GLStateCache::Stats mBindStats;
+
+    // Textured quads from DrawTexture are batched here
+    class SpriteBatch *mSpriteBatch;
+
+    // Streaming buffer for the UI draw list; grows by doubling
+    unsigned int mUIVertexArray;
+    unsigned int mUIVertexBuffer;
+    unsigned int mUIIndexBuffer;
+    int mUICapacity;
+
+    // mPackets[mRecordIndex] is written by the game thread; the other one
+    // belongs to the render thread while mFramePending is set
+    FramePacket mPackets[2];
+    int mRecordIndex;
+
+    std::thread mRenderThread;
+    std::mutex mFrameMutex;
+    std::condition_variable mFrameReady;
+    std::condition_variable mFrameDone;
+    bool mFramePending;
+    bool mStopRenderThread;
+
+    // Directory the shaders were found in (e.g. "../Shaders/")
+    std::string mShaderPath;
 
     // Sprite vertex array
     class VertexArray *mSpriteVerts;
     unsigned int mSpriteVertexArray;
+    unsigned int mSpriteVertexBuffer;
+    unsigned int mSpriteIndexBuffer;
+
+    // Sprite quad plus a per-instance buffer for DrawSpriteInstances
+    unsigned int mInstanceVertexArray;
+    unsigned int mInstanceBuffer;
+    int mInstanceBufferCapacity;
+
+    // Sprite quad plus a per-instance buffer for DrawRing
+    unsigned int mRingVertexArray;
+    unsigned int mRingBuffer;
+    int mRingBufferCapacity;
+
+    // Screen-sized quad for DrawBackground
+    unsigned int mBackgroundVertexArray;
+    unsigned int mBackgroundVertexBuffer;
+    Vector2 mScreenSize;
+
+    // Dynamic buffer re-filled every frame by the particle system
+    unsigned int mParticleVertexArray;
+    unsigned int mParticleVertexBuffer;
+    int mParticleBufferCapacity;
 
 	// Window
 	SDL_Window* mWindow;
@@ -68,9 +208,14 @@ private:
 	// OpenGL context
 	SDL_GLContext mContext;
 
-	// Ortho projection for 2D shaders
+	// Ortho projection for 2D shaders (screen space: pixels, y down)
 	Matrix4 mOrthoProjection;
 
     // Map of textures loaded
     std::unordered_map<std::string, class Texture *> mTextures;
+
+    // Sprite sheets packed together so they share a texture binding
+    TextureAtlas mSpriteAtlas;
+
+    GeometryCache mGeometry;
 };
\ No newline at end of file
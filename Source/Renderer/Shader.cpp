@@ -1,5 +1,6 @@
 #include <SDL.h>
 #include "Shader.h"
+#include <cstring>
 #include <fstream>
 #include <sstream>
 
@@ -29,7 +30,13 @@ bool Shader::Load(const std::string& name)
 	glAttachShader(mShaderProgram, mFragShader);
 	glLinkProgram(mShaderProgram);
 
-	return IsValidProgram();
+	if (!IsValidProgram())
+	{
+		return false;
+	}
+
+	ReflectUniforms();
+	return true;
 }
 
 void Shader::Unload()
@@ -42,6 +49,7 @@ void Shader::Unload()
 	mShaderProgram = 0;
 	mVertexShader = 0;
 	mFragShader = 0;
+	mUniforms.clear();
 }
 
 void Shader::SetActive() const
@@ -50,50 +58,112 @@ void Shader::SetActive() const
 	glUseProgram(mShaderProgram);
 }
 
-void Shader::SetVectorUniform(const char *name, const Vector2 &vector) const {
-    // Find the uniform by this name
-    GLint loc = glGetUniformLocation(mShaderProgram, name);
-
-    // Send the vector data to the uniform
-    glUniform2fv(loc, 1, vector.GetAsFloatPtr());
+UniformHandle Shader::GetUniform(const char *name) const
+{
+	UniformHandle handle;
+	for (size_t i = 0; i < mUniforms.size(); i++)
+	{
+		if (mUniforms[i].name == name)
+		{
+			handle.index = static_cast<int>(i);
+			break;
+		}
+	}
+	return handle;
 }
 
-void Shader::SetVectorUniform(const char* name, const Vector3& vector) const
+bool Shader::BindUniformBlock(const char *name, unsigned int binding)
 {
+	GLuint index = glGetUniformBlockIndex(mShaderProgram, name);
+	if (index == GL_INVALID_INDEX)
+	{
+		return false;
+	}
+	glUniformBlockBinding(mShaderProgram, index, binding);
+	return true;
+}
+
+void Shader::SetVectorUniform(UniformHandle handle, const Vector2 &vector) {
+    if (UpdateCache(handle, vector.GetAsFloatPtr(), 2 * sizeof(float))) {
+        glUniform2fv(mUniforms[handle.index].location, 1, vector.GetAsFloatPtr());
+    }
+}
 
-	GLint loc = glGetUniformLocation(mShaderProgram, name);
+void Shader::SetVectorUniform(UniformHandle handle, const Vector3 &vector) {
+    if (UpdateCache(handle, vector.GetAsFloatPtr(), 3 * sizeof(float))) {
+        glUniform3fv(mUniforms[handle.index].location, 1, vector.GetAsFloatPtr());
+    }
+}
 
-	glUniform3fv(loc, 1, vector.GetAsFloatPtr());
+void Shader::SetVectorUniform(UniformHandle handle, const Vector4 &vector) {
+    if (UpdateCache(handle, vector.GetAsFloatPtr(), 4 * sizeof(float))) {
+        glUniform4fv(mUniforms[handle.index].location, 1, vector.GetAsFloatPtr());
+    }
 }
 
-void Shader::SetVectorUniform(const char *name, const Vector4 &vector) const {
-    // Find the uniform by this name
-    GLint loc = glGetUniformLocation(mShaderProgram, name);
+void Shader::SetMatrixUniform(UniformHandle handle, const Matrix4 &matrix) {
+    if (UpdateCache(handle, matrix.GetAsFloatPtr(), 16 * sizeof(float))) {
+        glUniformMatrix4fv(mUniforms[handle.index].location, 1, GL_FALSE, matrix.GetAsFloatPtr());
+    }
+}
 
-    // Send the vector data to the uniform
-    glUniform4fv(loc, 1, vector.GetAsFloatPtr());
+void Shader::SetFloatUniform(UniformHandle handle, float value) {
+    if (UpdateCache(handle, &value, sizeof(float))) {
+        glUniform1f(mUniforms[handle.index].location, value);
+    }
 }
 
+void Shader::SetIntegerUniform(UniformHandle handle, int value) {
+    if (UpdateCache(handle, &value, sizeof(int))) {
+        glUniform1i(mUniforms[handle.index].location, value);
+    }
+}
 
-void Shader::SetMatrixUniform(const char* name, const Matrix4& matrix) const
+bool Shader::UpdateCache(UniformHandle handle, const void* data, size_t size)
 {
+	if (!handle.IsValid())
+	{
+		return false;
+	}
 
-	GLuint loc = glGetUniformLocation(mShaderProgram, name);
+	Uniform& uniform = mUniforms[handle.index];
+	if (uniform.hasValue && memcmp(uniform.value, data, size) == 0)
+	{
+		return false;
+	}
 
-	glUniformMatrix4fv(loc, 1, GL_FALSE, matrix.GetAsFloatPtr());
+	memcpy(uniform.value, data, size);
+	uniform.hasValue = true;
+	return true;
 }
 
-void Shader::SetFloatUniform(const char *name, float value) const {
-    // Find the uniform by this name
-    GLuint loc = glGetUniformLocation(mShaderProgram, name);
+void Shader::ReflectUniforms()
+{
+	mUniforms.clear();
 
-    // Send the float data to the uniform
-    glUniform1f(loc, value);
-}
+	GLint count = 0;
+	glGetProgramiv(mShaderProgram, GL_ACTIVE_UNIFORMS, &count);
 
-void Shader::SetIntegerUniform(const char *name, int value) const {
-    GLint uTexture = glGetUniformLocation(mFragShader, name);
-    glUniform1i(uTexture, value);
+	for (GLint i = 0; i < count; i++)
+	{
+		char name[256];
+		GLsizei length = 0;
+		GLint size = 0;
+		GLenum type = 0;
+		glGetActiveUniform(mShaderProgram, static_cast<GLuint>(i), sizeof(name), &length, &size, &type, name);
+
+		Uniform uniform;
+		uniform.name.assign(name, length);
+		// Arrays are reported as "name[0]"
+		size_t bracket = uniform.name.find('[');
+		if (bracket != std::string::npos)
+		{
+			uniform.name.resize(bracket);
+		}
+		uniform.location = glGetUniformLocation(mShaderProgram, name);
+		uniform.hasValue = false;
+		mUniforms.emplace_back(uniform);
+	}
 }
 
 bool Shader::CompileShader(const std::string& fileName, GLenum shaderType, GLuint& outShader)
@@ -1,8 +1,17 @@
 #pragma once
 #include <GL/glew.h>
 #include <string>
+#include <vector>
 #include "../Math.h"
 
+// Index into a shader's uniform table, returned by Shader::GetUniform.
+// Invalid handles (unknown or optimized-out names) are ignored by the setters.
+struct UniformHandle
+{
+    int index = -1;
+    bool IsValid() const { return index >= 0; }
+};
+
 class Shader
 {
 public:
@@ -16,14 +25,31 @@ public:
 
     // Set this as the active shader program
 	void SetActive() const;
+	GLuint GetProgram() const { return mShaderProgram; }
+
+    // Looks up a uniform reflected at link time
+    UniformHandle GetUniform(const char *name) const;
 
-    // Sets a Vector / Matrix uniform
-    void SetVectorUniform(const char *name, const Vector2 &vector) const;
-    void SetVectorUniform(const char *name, const Vector3 &vector) const;
-    void SetVectorUniform(const char *name, const Vector4 &vector) const;
-    void SetMatrixUniform(const char *name, const Matrix4 &matrix) const;
-    void SetFloatUniform(const char *name, float value) const;
-    void SetIntegerUniform(const char *name, int value) const;
+    // Attaches the uniform block called name to a buffer binding point;
+    // false if the program has no such block
+    bool BindUniformBlock(const char *name, unsigned int binding);
+
+    // Sets a Vector / Matrix uniform on this shader, which must be active.
+    // Values equal to the last upload through the same handle are skipped.
+    void SetVectorUniform(UniformHandle handle, const Vector2 &vector);
+    void SetVectorUniform(UniformHandle handle, const Vector3 &vector);
+    void SetVectorUniform(UniformHandle handle, const Vector4 &vector);
+    void SetMatrixUniform(UniformHandle handle, const Matrix4 &matrix);
+    void SetFloatUniform(UniformHandle handle, float value);
+    void SetIntegerUniform(UniformHandle handle, int value);
+
+    // By name, for one-off setup; per-draw code should keep the handle
+    void SetVectorUniform(const char *name, const Vector2 &vector) { SetVectorUniform(GetUniform(name), vector); }
+    void SetVectorUniform(const char *name, const Vector3 &vector) { SetVectorUniform(GetUniform(name), vector); }
+    void SetVectorUniform(const char *name, const Vector4 &vector) { SetVectorUniform(GetUniform(name), vector); }
+    void SetMatrixUniform(const char *name, const Matrix4 &matrix) { SetMatrixUniform(GetUniform(name), matrix); }
+    void SetFloatUniform(const char *name, float value) { SetFloatUniform(GetUniform(name), value); }
+    void SetIntegerUniform(const char *name, int value) { SetIntegerUniform(GetUniform(name), value); }
 
 private:
 	// Tries to compile the specified shader
@@ -34,6 +60,20 @@ private:
 	// Tests whether vertex/fragment programs link
 	bool IsValidProgram() const;
 
+	// Fills mUniforms with the program's active uniforms
+	void ReflectUniforms();
+	// Stores the value and returns true if it differs from the last upload
+	bool UpdateCache(UniformHandle handle, const void* data, size_t size);
+
+	struct Uniform
+	{
+		std::string name;
+		GLint location;
+		bool hasValue;
+		float value[16];
+	};
+	std::vector<Uniform> mUniforms;
+
 	// Store the shader object IDs
 	GLuint mVertexShader;
 	GLuint mFragShader;
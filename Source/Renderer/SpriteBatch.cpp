@@ -0,0 +1,135 @@
+#include <GL/glew.h>
+#include "SpriteBatch.h"
+#include "Shader.h"
+#include "Texture.h"
+#include "GLStateCache.h"
+
+SpriteBatch::SpriteBatch()
+: mShader(nullptr)
+, mState(nullptr)
+, mTexture(nullptr)
+, mNumSprites(0)
+, mVertexArray(0)
+, mVertexBuffer(0)
+, mIndexBuffer(0)
+{
+}
+
+SpriteBatch::~SpriteBatch()
+{
+}
+
+bool SpriteBatch::Initialize(Shader* shader, GLStateCache* state)
+{
+    mShader = shader;
+    mState = state;
+    mVertices.resize(MAX_SPRITES * 4 * FLOATS_PER_VERTEX);
+
+    // Same winding as the sprite quad: TL, TR, BR, BL
+    std::vector<unsigned int> indices(MAX_SPRITES * 6);
+    for (unsigned int i = 0; i < MAX_SPRITES; ++i)
+    {
+        unsigned int v = i * 4;
+        indices[i * 6 + 0] = v + 0;
+        indices[i * 6 + 1] = v + 1;
+        indices[i * 6 + 2] = v + 2;
+        indices[i * 6 + 3] = v + 2;
+        indices[i * 6 + 4] = v + 3;
+        indices[i * 6 + 5] = v + 0;
+    }
+
+    glGenVertexArrays(1, &mVertexArray);
+    glBindVertexArray(mVertexArray);
+
+    glGenBuffers(1, &mVertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, mVertices.size() * sizeof(float), nullptr, GL_DYNAMIC_DRAW);
+
+    glGenBuffers(1, &mIndexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+
+    const GLsizei stride = FLOATS_PER_VERTEX * sizeof(float);
+
+    // Position (location = 0)
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride, (void*)0);
+
+    // Texture coordinate (location = 1)
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, (void*)(2 * sizeof(float)));
+
+    // Tint and texture factor (location = 2, 3)
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, stride, (void*)(4 * sizeof(float)));
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, stride, (void*)(7 * sizeof(float)));
+
+    return true;
+}
+
+void SpriteBatch::Shutdown()
+{
+    glDeleteBuffers(1, &mVertexBuffer);
+    glDeleteBuffers(1, &mIndexBuffer);
+    glDeleteVertexArrays(1, &mVertexArray);
+    mVertexBuffer = mIndexBuffer = mVertexArray = 0;
+}
+
+void SpriteBatch::Draw(Texture* texture, const Vector2& position, const Vector2& size, float rotation,
+                       const Vector4& textureRect, const Vector3& color, bool flip, float textureFactor)
+{
+    if (texture != mTexture || mNumSprites == MAX_SPRITES)
+    {
+        Flush();
+        mTexture = texture;
+    }
+
+    // Corners of the unit sprite quad and their texture coordinates
+    static const float corners[4][4] = {
+        { -0.5f,  0.5f, 0.0f, 0.0f }, // top left
+        {  0.5f,  0.5f, 1.0f, 0.0f }, // top right
+        {  0.5f, -0.5f, 1.0f, 1.0f }, // bottom right
+        { -0.5f, -0.5f, 0.0f, 1.0f }  // bottom left
+    };
+
+    const float sx = flip ? -size.x : size.x;
+    const float sy = size.y;
+    const float c = Math::Cos(rotation);
+    const float s = Math::Sin(rotation);
+
+    float* out = &mVertices[mNumSprites * 4 * FLOATS_PER_VERTEX];
+    for (const auto& corner : corners)
+    {
+        // Scale, rotate, translate (same order as the sprite model matrix)
+        float x = corner[0] * sx;
+        float y = corner[1] * sy;
+        *out++ = x * c - y * s + position.x;
+        *out++ = x * s + y * c + position.y;
+        *out++ = textureRect.x + corner[2] * textureRect.z;
+        *out++ = textureRect.y + corner[3] * textureRect.w;
+        *out++ = color.x;
+        *out++ = color.y;
+        *out++ = color.z;
+        *out++ = textureFactor;
+    }
+
+    mNumSprites++;
+}
+
+void SpriteBatch::Flush()
+{
+    if (mNumSprites == 0)
+    {
+        return;
+    }
+
+    mState->UseProgram(mShader);
+    mState->BindTexture(mTexture);
+    mState->BindVertexArray(mVertexArray);
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, mNumSprites * 4 * FLOATS_PER_VERTEX * sizeof(float), mVertices.data());
+    glDrawElements(GL_TRIANGLES, mNumSprites * 6, GL_UNSIGNED_INT, nullptr);
+
+    mNumSprites = 0;
+}
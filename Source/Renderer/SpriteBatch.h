@@ -0,0 +1,41 @@
+#pragma once
+#include <vector>
+#include "../Math.h"
+
+// Collects textured quads into one dynamic vertex buffer and draws them with
+// a single glDrawElements per run of sprites sharing a texture. Quads are
+// transformed on the CPU, so any number of sprites needs no uniform uploads.
+class SpriteBatch
+{
+public:
+    static const int MAX_SPRITES = 4096;
+
+    SpriteBatch();
+    ~SpriteBatch();
+
+    bool Initialize(class Shader* shader, class GLStateCache* state);
+    void Shutdown();
+
+    // position is the quad center in screen space (camera already applied)
+    void Draw(class Texture* texture, const Vector2& position, const Vector2& size, float rotation,
+              const Vector4& textureRect, const Vector3& color, bool flip, float textureFactor);
+
+    // Draws everything queued; called on texture change, when full and by
+    // any non-batched draw so ordering is preserved
+    void Flush();
+
+private:
+    // x, y, u, v, r, g, b, textureFactor
+    static const int FLOATS_PER_VERTEX = 8;
+
+    class Shader* mShader;
+    class GLStateCache* mState;
+    class Texture* mTexture;
+    int mNumSprites;
+
+    std::vector<float> mVertices;
+
+    unsigned int mVertexArray;
+    unsigned int mVertexBuffer;
+    unsigned int mIndexBuffer;
+};
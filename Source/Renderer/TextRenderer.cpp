@@ -1,12 +1,14 @@
 #include "TextRenderer.h"
 #include "../Game.h"
 #include "Texture.h"
+#include "UIDrawList.h"
 #include <SDL_ttf.h>
 #include <SDL.h>
 #include <GL/glew.h>
 
 TTF_Font* TextRenderer::sFont = nullptr;
 bool TextRenderer::sInitialized = false;
+std::unordered_map<int, TextRenderer::GlyphAtlas*> TextRenderer::sAtlases;
 
 bool TextRenderer::Initialize()
 {
@@ -49,6 +51,17 @@ bool TextRenderer::Initialize()
 
 void TextRenderer::Shutdown()
 {
+    for (auto& pair : sAtlases)
+    {
+        if (pair.second->texture)
+        {
+            pair.second->texture->Unload();
+            delete pair.second->texture;
+        }
+        delete pair.second;
+    }
+    sAtlases.clear();
+
     if (sFont)
     {
         TTF_CloseFont(sFont);
@@ -63,6 +76,12 @@ void TextRenderer::Shutdown()
 }
 
 void TextRenderer::DrawText(Renderer* renderer, const std::string& text, const Vector2& position, float scale, const Vector3& color)
+{
+    AddText(renderer->GetUIDrawList(), text, position, scale, color);
+}
+
+void TextRenderer::AddText(UIDrawList* list, const std::string& text, const Vector2& position, float scale,
+                           const Vector3& color)
 {
     if (!sInitialized)
     {
@@ -79,59 +98,152 @@ void TextRenderer::DrawText(Renderer* renderer, const std::string& text, const V
     
     // Set font size based on scale - reduced base size for better UI scaling
     int fontSize = static_cast<int>(10.0f * scale);
-    TTF_SetFontSize(sFont, fontSize);
-    
-    // Create text surface
-    SDL_Color sdlColor;
-    sdlColor.r = static_cast<Uint8>(color.x * 255.0f);
-    sdlColor.g = static_cast<Uint8>(color.y * 255.0f);
-    sdlColor.b = static_cast<Uint8>(color.z * 255.0f);
-    sdlColor.a = 255;
-    
-    SDL_Surface* textSurface = TTF_RenderText_Solid(sFont, text.c_str(), sdlColor);
-    if (!textSurface)
+    GlyphAtlas* atlas = GetAtlas(fontSize);
+    if (!atlas)
     {
-        SDL_Log("Unable to render text surface! SDL_ttf Error: %s\n", TTF_GetError());
         return;
     }
-    
-    Vector2 size(static_cast<float>(textSurface->w), static_cast<float>(textSurface->h));
-    
-    // Create a Texture object from the surface
-    Texture textTexture;
-    if (!textTexture.LoadFromSurface(textSurface))
+
+    // Glyphs are laid out left to right from the top-left corner; they all
+    // share the atlas texture, so a string is one run in the draw list
+    float penX = position.x;
+    for (unsigned char c : text)
     {
-        SDL_Log("Unable to create texture from text surface!");
-        SDL_FreeSurface(textSurface);
-        return;
+        if (c < FIRST_GLYPH)
+        {
+            continue;
+        }
+
+        const Glyph& glyph = atlas->glyphs[c - FIRST_GLYPH];
+        if (glyph.size.x > 0.0f)
+        {
+            list->Image(Vector2(penX, position.y), glyph.size, atlas->texture, glyph.rect, color);
+        }
+        penX += glyph.advance;
     }
-    
-    // For screen-space UI rendering:
-    // DrawTexture calculates: finalPos = position + (screenCenter - cameraPos)
-    // We want finalPos = position (the screen coordinate passed in)
-    // So: position = position + screenCenter - cameraPos
-    // Therefore: cameraPos = screenCenter
-    // And we pass position directly (already in screen coordinates)
-    Vector2 screenCenter(1024.0f / 2.0f, 768.0f / 2.0f);
-    
-    // The sprite vertices are centered at (0,0), so the texture is drawn centered at the position.
-    // The position passed in is the top-left corner where text should be.
-    // To make the sprite render with its top-left at the position, we need to offset by half the size.
-    // Since sprite center is at position, and we want top-left at position:
-    // sprite top-left = position - size/2, so we need center = position + size/2
-    Vector2 centeredPos = position + Vector2(size.x * 0.5f, size.y * 0.5f);
-    
-    // Flip texture coordinates vertically because SDL_Surface is top-to-bottom
-    // but OpenGL expects bottom-to-top. TextureRect format: (x, y, width, height)
-    // We flip by using y=1.0f and height=-1.0f to reverse the V coordinate
-    Vector4 textureRect(0.0f, 1.0f, 1.0f, -1.0f);
-    
-    // Pass centered position (screen coordinates) and cameraPos = screenCenter
-    // This makes finalPos = centeredPos + screenCenter - screenCenter = centeredPos ✓
-    renderer->DrawTexture(centeredPos, size, 0.0f, Vector3(1.0f, 1.0f, 1.0f), 
-                         &textTexture, textureRect, screenCenter, false, 1.0f);
-    
-    // Clean up
-    textTexture.Unload();
-    SDL_FreeSurface(textSurface);
+}
+
+TextRenderer::GlyphAtlas* TextRenderer::GetAtlas(int fontSize)
+{
+    if (fontSize <= 0)
+    {
+        return nullptr;
+    }
+
+    auto iter = sAtlases.find(fontSize);
+    if (iter != sAtlases.end())
+    {
+        return iter->second;
+    }
+
+    // Built once per size; failures are cached too so we don't retry every frame
+    GlyphAtlas* atlas = BuildAtlas(fontSize);
+    sAtlases.emplace(fontSize, atlas);
+    return atlas;
+}
+
+TextRenderer::GlyphAtlas* TextRenderer::BuildAtlas(int fontSize)
+{
+    TTF_SetFontSize(sFont, fontSize);
+
+    // White glyphs; DrawText tints them with the vertex color
+    SDL_Color white;
+    white.r = white.g = white.b = white.a = 255;
+
+    const int atlasWidth = 512;
+    const int padding = 1;
+
+    SDL_Surface* surfaces[NUM_GLYPHS] = {};
+    SDL_Rect placement[NUM_GLYPHS] = {};
+    auto* atlas = new GlyphAtlas();
+    atlas->texture = nullptr;
+
+    // Row packing: every glyph is one font height tall
+    int penX = 0;
+    int penY = 0;
+    int rowHeight = 0;
+    for (int i = 0; i < NUM_GLYPHS; ++i)
+    {
+        auto ch = static_cast<Uint16>(FIRST_GLYPH + i);
+        Glyph& glyph = atlas->glyphs[i];
+        glyph.rect = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
+        glyph.size = Vector2::Zero;
+        glyph.advance = 0.0f;
+
+        int minX, maxX, minY, maxY, advance;
+        if (TTF_GlyphMetrics(sFont, ch, &minX, &maxX, &minY, &maxY, &advance) == 0)
+        {
+            glyph.advance = static_cast<float>(advance);
+        }
+
+        SDL_Surface* rendered = TTF_RenderGlyph_Solid(sFont, ch, white);
+        if (!rendered)
+        {
+            continue;
+        }
+        surfaces[i] = SDL_ConvertSurfaceFormat(rendered, SDL_PIXELFORMAT_RGBA32, 0);
+        SDL_FreeSurface(rendered);
+        if (!surfaces[i])
+        {
+            continue;
+        }
+
+        int w = surfaces[i]->w + padding;
+        int h = surfaces[i]->h + padding;
+        if (penX + w > atlasWidth)
+        {
+            penX = 0;
+            penY += rowHeight;
+            rowHeight = 0;
+        }
+        placement[i] = SDL_Rect{ penX, penY, surfaces[i]->w, surfaces[i]->h };
+        penX += w;
+        rowHeight = rowHeight > h ? rowHeight : h;
+    }
+    int atlasHeight = penY + rowHeight;
+
+    SDL_Surface* atlasSurface = atlasHeight > 0
+        ? SDL_CreateRGBSurfaceWithFormat(0, atlasWidth, atlasHeight, 32, SDL_PIXELFORMAT_RGBA32)
+        : nullptr;
+
+    for (int i = 0; i < NUM_GLYPHS; ++i)
+    {
+        if (!surfaces[i])
+        {
+            continue;
+        }
+
+        if (atlasSurface)
+        {
+            SDL_SetSurfaceBlendMode(surfaces[i], SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(surfaces[i], nullptr, atlasSurface, &placement[i]);
+
+            Glyph& glyph = atlas->glyphs[i];
+            const SDL_Rect& r = placement[i];
+            glyph.size = Vector2(static_cast<float>(r.w), static_cast<float>(r.h));
+            glyph.rect = Vector4(static_cast<float>(r.x) / atlasWidth, static_cast<float>(r.y) / atlasHeight,
+                                 static_cast<float>(r.w) / atlasWidth, static_cast<float>(r.h) / atlasHeight);
+        }
+        SDL_FreeSurface(surfaces[i]);
+    }
+
+    if (!atlasSurface)
+    {
+        SDL_Log("Unable to build glyph atlas for font size %d", fontSize);
+        delete atlas;
+        return nullptr;
+    }
+
+    // Pixel font: nearest filtering keeps the glyph edges sharp
+    atlas->texture = new Texture();
+    if (!atlas->texture->LoadFromSurface(atlasSurface, false))
+    {
+        SDL_Log("Unable to create glyph atlas texture!");
+        delete atlas->texture;
+        delete atlas;
+        atlas = nullptr;
+    }
+    SDL_FreeSurface(atlasSurface);
+
+    return atlas;
 }
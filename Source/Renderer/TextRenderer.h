@@ -2,6 +2,7 @@
 #include "../Math.h"
 #include "Renderer.h"
 #include <string>
+#include <unordered_map>
 #include <SDL_ttf.h>
 
 class TextRenderer
@@ -9,9 +10,34 @@ class TextRenderer
 public:
     static bool Initialize();
     static void Shutdown();
+    // Records screen-space text into the renderer's UI draw list
     static void DrawText(Renderer* renderer, const std::string& text, const Vector2& position, float scale, const Vector3& color);
+    static void AddText(class UIDrawList* list, const std::string& text, const Vector2& position, float scale,
+                        const Vector3& color);
     
 private:
+    // Latin-1, the encoding TTF_RenderText used for our strings
+    static const int FIRST_GLYPH = 32;
+    static const int NUM_GLYPHS = 256 - FIRST_GLYPH;
+
+    struct Glyph
+    {
+        Vector4 rect;   // normalized rect inside the atlas texture
+        Vector2 size;   // in pixels; zero for glyphs with nothing to draw
+        float advance;
+    };
+
+    // Every glyph of one font size rasterized once into a single texture
+    struct GlyphAtlas
+    {
+        class Texture* texture;
+        Glyph glyphs[NUM_GLYPHS];
+    };
+
+    static GlyphAtlas* GetAtlas(int fontSize);
+    static GlyphAtlas* BuildAtlas(int fontSize);
+
     static TTF_Font* sFont;
     static bool sInitialized;
+    static std::unordered_map<int, GlyphAtlas*> sAtlases;
 };
@@ -3,6 +3,10 @@
 
 Texture::Texture()
     : mTextureID(0)
+      , mPixels(nullptr)
+      , mFilter(GL_NEAREST)
+      , mWrap(GL_REPEAT)
+      , mWrapChanged(false)
       , mWidth(0)
       , mHeight(0) {
 }
@@ -20,55 +24,77 @@ bool Texture::Load(const std::string &filePath) {
         SDL_Log("Failed to load texture file %s", filePath.c_str());
         return false;
     }
-    mWidth = surf->w;
-    mHeight = surf->h;
 
-    glGenTextures(1, &mTextureID);
-    glBindTexture(GL_TEXTURE_2D, mTextureID);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, mWidth, mHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, surf->pixels);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    bool loaded = LoadFromSurface(surf, false);
     SDL_FreeSurface(surf);
 
-    return true;
+    return loaded;
 }
 
-bool Texture::LoadFromSurface(SDL_Surface* surface) {
+bool Texture::LoadFromSurface(SDL_Surface* surface, bool linearFilter) {
     if (!surface) {
         return false;
     }
-    
+
+    // Always a copy: the caller frees its surface before the upload happens
+    SDL_Surface *pixels = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+    if (!pixels) {
+        return false;
+    }
+
+    Unload();
+    mPixels = pixels;
     mWidth = surface->w;
     mHeight = surface->h;
-    
-    // Convert to RGBA if needed
-    SDL_Surface* formattedSurface = nullptr;
-    if (surface->format->format != SDL_PIXELFORMAT_RGBA32) {
-        formattedSurface = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
-        if (!formattedSurface) {
-            return false;
-        }
-        surface = formattedSurface;
-    }
-    
+    mFilter = linearFilter ? GL_LINEAR : GL_NEAREST;
+
+    return true;
+}
+
+void Texture::Upload() {
     glGenTextures(1, &mTextureID);
     glBindTexture(GL_TEXTURE_2D, mTextureID);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, mWidth, mHeight, 0,
-                 GL_RGBA, GL_UNSIGNED_BYTE, surface->pixels);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    
-    if (formattedSurface) {
-        SDL_FreeSurface(formattedSurface);
-    }
-    
-    return true;
+                 GL_RGBA, GL_UNSIGNED_BYTE, mPixels->pixels);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, mFilter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, mFilter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, mWrap);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, mWrap);
+    mWrapChanged = false;
+
+    SDL_FreeSurface(mPixels);
+    mPixels = nullptr;
 }
 
 void Texture::Unload() {
-    glDeleteTextures(1, &mTextureID);
+    if (mPixels) {
+        SDL_FreeSurface(mPixels);
+        mPixels = nullptr;
+    }
+    if (mTextureID != 0) {
+        glDeleteTextures(1, &mTextureID);
+        mTextureID = 0;
+    }
 }
 
-void Texture::SetActive(int index) const {
+void Texture::SetRepeat(bool repeat) {
+    GLint wrap = repeat ? GL_REPEAT : GL_CLAMP_TO_EDGE;
+    if (wrap != mWrap) {
+        mWrap = wrap;
+        mWrapChanged = true;
+    }
+}
+
+void Texture::SetActive(int index) {
+    if (mPixels) {
+        Upload();
+    }
     glBindTexture(GL_TEXTURE_2D, mTextureID);
+
+    // Set by SetRepeat since the last bind
+    if (mWrapChanged) {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, mWrap);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, mWrap);
+        mWrapChanged = false;
+    }
 }
@@ -4,6 +4,8 @@
 #include <SDL.h>
 #include <SDL_image.h>
 
+// Pixels are kept on the CPU until the first SetActive, so textures can be
+// loaded on the game thread while the render thread owns the GL context.
 class Texture {
 public:
     Texture();
@@ -11,11 +13,18 @@ public:
     ~Texture();
 
     bool Load(const std::string &fileName);
-    bool LoadFromSurface(SDL_Surface* surface);
+    // Linear filtering suits text; pixel art (atlas pages) wants nearest
+    bool LoadFromSurface(SDL_Surface* surface, bool linearFilter = true);
 
     void Unload();
 
-    void SetActive(int index = 0) const;
+    // GL_REPEAT (the GL default) or clamp to edge; applied on the next
+    // SetActive. Render thread only, like SetActive (the game thread asks
+    // through a FramePacket command, e.g. Renderer::DrawBackground).
+    void SetRepeat(bool repeat);
+
+    // Uploads the pixels first if this is the first bind
+    void SetActive(int index = 0);
 
     static GLenum SDLFormatToGL(SDL_PixelFormat *fmt);
 
@@ -23,10 +32,18 @@ public:
     int GetHeight() const { return mHeight; }
 
     unsigned int GetTextureID() const { return mTextureID; }
+    // Pixels or a wrap mode still to be applied by SetActive
+    bool IsPending() const { return mPixels || mWrapChanged; }
 
 private:
+    void Upload();
+
     unsigned int mTextureID;
-    const void *mPixels;
+    // RGBA32 copy waiting for Upload (null once uploaded)
+    SDL_Surface *mPixels;
+    GLint mFilter;
+    GLint mWrap;
+    bool mWrapChanged;
     int mWidth;
     int mHeight;
 };
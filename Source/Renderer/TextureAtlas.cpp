@@ -0,0 +1,200 @@
+#include <algorithm>
+#include <SDL.h>
+#include <SDL_image.h>
+#include "TextureAtlas.h"
+#include "Texture.h"
+
+namespace
+{
+    struct PackedImage
+    {
+        std::string fileName;
+        SDL_Surface* surface;
+        int page;
+        int x;
+        int y;
+    };
+
+    struct PageExtent
+    {
+        int width;
+        int height;
+    };
+}
+
+TextureAtlas::TextureAtlas()
+{
+}
+
+TextureAtlas::~TextureAtlas()
+{
+}
+
+bool TextureAtlas::Build(const std::vector<std::string>& fileNames, int pageSize, int padding)
+{
+    Unload();
+
+    if (IMG_Init(IMG_INIT_PNG) == 0)
+    {
+        SDL_Log("Unable to initialize SDL_image: %s", SDL_GetError());
+        return false;
+    }
+
+    std::vector<PackedImage> images;
+    for (const auto& fileName : fileNames)
+    {
+        SDL_Surface* loaded = IMG_Load(fileName.c_str());
+        if (!loaded)
+        {
+            SDL_Log("Failed to load atlas image %s", fileName.c_str());
+            continue;
+        }
+
+        SDL_Surface* surface = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+        SDL_FreeSurface(loaded);
+        if (!surface)
+        {
+            continue;
+        }
+
+        if (surface->w + 2 * padding > pageSize || surface->h + 2 * padding > pageSize)
+        {
+            SDL_Log("Atlas image %s is larger than a page", fileName.c_str());
+            SDL_FreeSurface(surface);
+            continue;
+        }
+
+        images.push_back({ fileName, surface, 0, 0, 0 });
+    }
+
+    if (images.empty())
+    {
+        return false;
+    }
+
+    // Shelf packing: tallest first keeps the wasted space under each shelf small
+    std::sort(images.begin(), images.end(), [](const PackedImage& a, const PackedImage& b)
+    {
+        return a.surface->h > b.surface->h;
+    });
+
+    std::vector<PageExtent> pageExtents(1, PageExtent{ 0, 0 });
+    int page = 0;
+    int cursorX = 0;
+    int cursorY = 0;
+    int shelfHeight = 0;
+
+    for (auto& image : images)
+    {
+        int w = image.surface->w + 2 * padding;
+        int h = image.surface->h + 2 * padding;
+
+        if (cursorX + w > pageSize)
+        {
+            cursorX = 0;
+            cursorY += shelfHeight;
+            shelfHeight = 0;
+        }
+        if (cursorY + h > pageSize)
+        {
+            page++;
+            pageExtents.push_back(PageExtent{ 0, 0 });
+            cursorX = 0;
+            cursorY = 0;
+            shelfHeight = 0;
+        }
+
+        image.page = page;
+        image.x = cursorX + padding;
+        image.y = cursorY + padding;
+
+        cursorX += w;
+        shelfHeight = std::max(shelfHeight, h);
+        pageExtents[page].width = std::max(pageExtents[page].width, cursorX);
+        pageExtents[page].height = std::max(pageExtents[page].height, cursorY + h);
+    }
+
+    for (int p = 0; p < static_cast<int>(pageExtents.size()); ++p)
+    {
+        int width = pageExtents[p].width;
+        int height = pageExtents[p].height;
+
+        // New surfaces start fully transparent, which is the padding
+        SDL_Surface* pageSurface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+        if (!pageSurface)
+        {
+            SDL_Log("Failed to create atlas page: %s", SDL_GetError());
+            continue;
+        }
+
+        for (const auto& image : images)
+        {
+            if (image.page != p)
+            {
+                continue;
+            }
+
+            // Copy the pixels as they are instead of blending onto the page
+            SDL_SetSurfaceBlendMode(image.surface, SDL_BLENDMODE_NONE);
+            SDL_Rect dest{ image.x, image.y, image.surface->w, image.surface->h };
+            SDL_BlitSurface(image.surface, nullptr, pageSurface, &dest);
+        }
+
+        auto* texture = new Texture();
+        if (!texture->LoadFromSurface(pageSurface, false))
+        {
+            delete texture;
+            texture = nullptr;
+        }
+        SDL_FreeSurface(pageSurface);
+        mPages.emplace_back(texture);
+
+        if (!texture)
+        {
+            continue;
+        }
+
+        for (const auto& image : images)
+        {
+            if (image.page != p)
+            {
+                continue;
+            }
+
+            Region region;
+            region.texture = texture;
+            region.rect = Vector4(static_cast<float>(image.x) / width, static_cast<float>(image.y) / height,
+                                  static_cast<float>(image.surface->w) / width,
+                                  static_cast<float>(image.surface->h) / height);
+            mRegions.emplace(image.fileName, region);
+        }
+    }
+
+    for (auto& image : images)
+    {
+        SDL_FreeSurface(image.surface);
+    }
+
+    SDL_Log("Packed %zu images into %zu atlas page(s)", mRegions.size(), mPages.size());
+    return !mRegions.empty();
+}
+
+void TextureAtlas::Unload()
+{
+    for (auto* page : mPages)
+    {
+        if (page)
+        {
+            page->Unload();
+            delete page;
+        }
+    }
+    mPages.clear();
+    mRegions.clear();
+}
+
+const TextureAtlas::Region* TextureAtlas::GetRegion(const std::string& fileName) const
+{
+    auto iter = mRegions.find(fileName);
+    return iter != mRegions.end() ? &iter->second : nullptr;
+}
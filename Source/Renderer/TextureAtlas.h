@@ -0,0 +1,35 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "../Math.h"
+
+// Packs many small images into a few large textures ("pages") at load time,
+// so sprites from different sheets can be drawn without rebinding.
+// Images are placed on shelves, tallest first, with transparent padding
+// around each one so neighbours never bleed into each other.
+class TextureAtlas
+{
+public:
+    struct Region
+    {
+        class Texture* texture;
+        // Normalized x, y, width, height inside the page
+        Vector4 rect;
+    };
+
+    TextureAtlas();
+    ~TextureAtlas();
+
+    // Images that fail to load or don't fit in a page are skipped
+    bool Build(const std::vector<std::string>& fileNames, int pageSize = 1024, int padding = 2);
+    void Unload();
+
+    // Null if the file was not packed
+    const Region* GetRegion(const std::string& fileName) const;
+    size_t GetNumPages() const { return mPages.size(); }
+
+private:
+    std::vector<class Texture*> mPages;
+    std::unordered_map<std::string, Region> mRegions;
+};
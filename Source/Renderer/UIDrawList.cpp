@@ -0,0 +1,100 @@
+#include "UIDrawList.h"
+
+UIDrawList::UIDrawList()
+: mNumQuads(0)
+{
+}
+
+void UIDrawList::Rect(const Vector2& topLeft, const Vector2& size, const Vector3& color, float thickness)
+{
+    Outline({ topLeft, Vector2(topLeft.x + size.x, topLeft.y), topLeft + size, Vector2(topLeft.x, topLeft.y + size.y) },
+            color, thickness);
+}
+
+void UIDrawList::Outline(std::initializer_list<Vector2> points, const Vector3& color, float thickness)
+{
+    if (points.size() < 2)
+    {
+        return;
+    }
+
+    const Vector2* prev = points.end() - 1;
+    for (const Vector2& point : points)
+    {
+        AddLine(*prev, point, color, thickness);
+        prev = &point;
+    }
+}
+
+void UIDrawList::Image(const Vector2& topLeft, const Vector2& size, Texture* texture, const Vector4& textureRect,
+                       const Vector3& color)
+{
+    if (!texture)
+    {
+        return;
+    }
+
+    AddQuad(texture, topLeft, Vector2(topLeft.x + size.x, topLeft.y), topLeft + size,
+            Vector2(topLeft.x, topLeft.y + size.y), textureRect, color, 1.0f);
+}
+
+void UIDrawList::AddLine(const Vector2& a, const Vector2& b, const Vector3& color, float thickness)
+{
+    Vector2 dir = b - a;
+    if (dir.LengthSq() <= 0.0f)
+    {
+        return;
+    }
+    dir.Normalize();
+
+    // Extend both ends by half the thickness so the corners of a loop meet
+    Vector2 along = dir * (thickness * 0.5f);
+    Vector2 across(-along.y, along.x);
+    AddQuad(nullptr, a - along + across, b + along + across, b + along - across, a - along - across,
+            Vector4::UnitRect, color, 0.0f);
+}
+
+void UIDrawList::AddQuad(Texture* texture, const Vector2& p0, const Vector2& p1, const Vector2& p2,
+                         const Vector2& p3, const Vector4& textureRect, const Vector3& color, float textureFactor)
+{
+    // Solid quads join any command; a textured one needs a matching or solid command
+    Command* command = mCommands.empty() ? nullptr : &mCommands.back();
+    if (texture && command && command->texture && command->texture != texture)
+    {
+        command = nullptr;
+    }
+    if (!command)
+    {
+        mCommands.push_back({ texture, mNumQuads, 0 });
+        command = &mCommands.back();
+    }
+    if (texture)
+    {
+        command->texture = texture;
+    }
+    command->numQuads++;
+
+    const Vector2* corners[4] = { &p0, &p1, &p2, &p3 };
+    const float u[4] = { 0.0f, 1.0f, 1.0f, 0.0f };
+    const float v[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+    for (int i = 0; i < 4; ++i)
+    {
+        mVertices.emplace_back(corners[i]->x);
+        mVertices.emplace_back(corners[i]->y);
+        mVertices.emplace_back(textureRect.x + u[i] * textureRect.z);
+        mVertices.emplace_back(textureRect.y + v[i] * textureRect.w);
+        mVertices.emplace_back(color.x);
+        mVertices.emplace_back(color.y);
+        mVertices.emplace_back(color.z);
+        mVertices.emplace_back(textureFactor);
+    }
+
+    mNumQuads++;
+}
+
+void UIDrawList::Clear()
+{
+    mVertices.clear();
+    mCommands.clear();
+    mNumQuads = 0;
+}
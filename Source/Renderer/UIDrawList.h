@@ -0,0 +1,52 @@
+#pragma once
+#include <initializer_list>
+#include <vector>
+#include "../Math.h"
+
+// Immediate-mode draw list for HUD and menus. Calls record screen-space
+// quads (pixels, origin at the top-left); the renderer uploads them into one
+// persistent streaming buffer and draws them on top of the frame. Lines are
+// emitted as thin quads, so solid shapes never break a batch and only
+// texture changes (text sizes, images) add draw calls. The list itself holds
+// no GL objects, so it can be recorded on the game thread.
+class UIDrawList
+{
+public:
+    // x, y, u, v, r, g, b, textureFactor (same layout as SpriteBatch)
+    static const int FLOATS_PER_VERTEX = 8;
+
+    // Consecutive quads drawn with one texture (null: solid quads only)
+    struct Command
+    {
+        class Texture* texture;
+        int firstQuad;
+        int numQuads;
+    };
+
+    UIDrawList();
+
+    // Rectangle border, like the old GL_LINE_LOOP panels
+    void Rect(const Vector2& topLeft, const Vector2& size, const Vector3& color, float thickness = 1.0f);
+    // Closed polygon border
+    void Outline(std::initializer_list<Vector2> points, const Vector3& color, float thickness = 1.0f);
+    // Texture (or textureRect of it) stretched over the rectangle
+    void Image(const Vector2& topLeft, const Vector2& size, class Texture* texture,
+               const Vector4& textureRect = Vector4::UnitRect, const Vector3& color = Vector3::One);
+
+    // Drops what was recorded
+    void Clear();
+
+    const std::vector<float>& GetVertices() const { return mVertices; }
+    const std::vector<Command>& GetCommands() const { return mCommands; }
+    int GetNumQuads() const { return mNumQuads; }
+
+private:
+    // Corners in order top-left, top-right, bottom-right, bottom-left
+    void AddQuad(class Texture* texture, const Vector2& p0, const Vector2& p1, const Vector2& p2, const Vector2& p3,
+                 const Vector4& textureRect, const Vector3& color, float textureFactor);
+    void AddLine(const Vector2& a, const Vector2& b, const Vector3& color, float thickness);
+
+    std::vector<float> mVertices;
+    std::vector<Command> mCommands;
+    int mNumQuads;
+};
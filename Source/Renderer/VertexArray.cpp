@@ -1,45 +1,105 @@
 #include "VertexArray.h"
 #include <GL/glew.h>
 
-VertexArray::VertexArray(const float* verts, unsigned int numVerts, const unsigned int* indices,
-						 unsigned int numIndices)
+VertexArray::VertexArray(const void* verts, unsigned int numVerts, Layout layout,
+						 const unsigned int* indices, unsigned int numIndices)
 : mNumVerts(numVerts)
-, mNumIndices(numIndices)
+, mNumIndices(indices ? numIndices : 0)
+, mLayout(layout)
 , mVertexBuffer(0)
 , mIndexBuffer(0)
 , mVertexArray(0)
+, mPendingVerts(static_cast<const unsigned char*>(verts),
+				static_cast<const unsigned char*>(verts) + numVerts * GetVertexSize(layout))
+{
+	if (indices)
+	{
+		mPendingIndices.assign(indices, indices + numIndices);
+	}
+}
+
+VertexArray::~VertexArray()
+{
+	if (mVertexArray != 0)
+	{
+		glDeleteBuffers(1, &mVertexBuffer);
+		if (mIndexBuffer != 0)
+		{
+			glDeleteBuffers(1, &mIndexBuffer);
+		}
+		glDeleteVertexArrays(1, &mVertexArray);
+	}
+}
+
+unsigned int VertexArray::GetVertexSize(Layout layout)
+{
+	switch (layout)
+	{
+		case Layout::Pos2:
+			return 2 * sizeof(float);
+		case Layout::Pos3Tex2:
+			return 5 * sizeof(float);
+	}
+	return 0;
+}
+
+void VertexArray::Upload()
 {
 	// Create vertex array
 	glGenVertexArrays(1, &mVertexArray);
 	glBindVertexArray(mVertexArray);
 
 	// Create vertex buffer
+	const GLsizei stride = GetVertexSize(mLayout);
 	glGenBuffers(1, &mVertexBuffer);
 	glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
-	glBufferData(GL_ARRAY_BUFFER, numVerts * 3 * sizeof(float), verts, GL_STATIC_DRAW);
+	glBufferData(GL_ARRAY_BUFFER, mNumVerts * stride, mPendingVerts.data(), GL_STATIC_DRAW);
 
-    // Create index buffer
-	glGenBuffers(1, &mIndexBuffer);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, numIndices * sizeof(GLuint), indices, GL_STATIC_DRAW);
+	// Index buffer only when the vertices are not drawn in order
+	if (mNumIndices > 0)
+	{
+		glGenBuffers(1, &mIndexBuffer);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, mNumIndices * sizeof(GLuint), mPendingIndices.data(), GL_STATIC_DRAW);
+	}
 
-	// Specify the vertex attributes (For now, assume one vertex format) Position is 3 floats
+	// Position (location = 0)
+	const GLint positionSize = mLayout == Layout::Pos3Tex2 ? 3 : 2;
 	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*) 0);
-	
-	// Disable texture coordinate attribute for geometry without textures
-	glDisableVertexAttribArray(1);
+	glVertexAttribPointer(0, positionSize, GL_FLOAT, GL_FALSE, stride, (void*)0);
+
+	// Texture coordinates (location = 1), disabled for geometry without textures
+	if (mLayout == Layout::Pos3Tex2)
+	{
+		glEnableVertexAttribArray(1);
+		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, (void*)(positionSize * sizeof(float)));
+	}
+	else
+	{
+		glDisableVertexAttribArray(1);
+	}
+
+	mPendingVerts = std::vector<unsigned char>();
+	mPendingIndices = std::vector<unsigned int>();
 }
 
-VertexArray::~VertexArray()
+void VertexArray::SetActive()
 {
-	glDeleteBuffers(1, &mVertexBuffer);
-	glDeleteBuffers(1, &mIndexBuffer);
-	glDeleteVertexArrays(1, &mVertexArray);
+	if (mVertexArray == 0)
+	{
+		Upload();
+	}
+	glBindVertexArray(mVertexArray);
 }
 
-void VertexArray::SetActive() const
+void VertexArray::Draw(unsigned int mode) const
 {
-	glBindVertexArray(mVertexArray);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
-}
\ No newline at end of file
+	if (mNumIndices > 0)
+	{
+		glDrawElements(mode, mNumIndices, GL_UNSIGNED_INT, nullptr);
+	}
+	else
+	{
+		glDrawArrays(mode, 0, mNumVerts);
+	}
+}
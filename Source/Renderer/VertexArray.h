@@ -1,19 +1,53 @@
 #pragma once
+#include <vector>
+
+// The GL buffers are created on the first SetActive, so vertex arrays can be
+// built on the game thread while the render thread owns the GL context. Once
+// drawn they must be deleted on the render thread (see Renderer::Release).
 class VertexArray
 {
 public:
-	VertexArray(const float* verts, unsigned int numVerts, const unsigned int* indices,
-				unsigned int numIndices);
+	// Interleaved vertex formats. Position is attribute 0 and tex coords 1;
+	// a vec2 position reaches a vec3 shader input with z = 0.
+	enum class Layout
+	{
+		Pos2,       // x, y (shapes)
+		Pos3Tex2    // x, y, z, u, v (sprite quad)
+	};
+
+	// Without indices the vertices are drawn in order with glDrawArrays and
+	// no index buffer is created
+	VertexArray(const void* verts, unsigned int numVerts, Layout layout,
+				const unsigned int* indices = nullptr, unsigned int numIndices = 0);
 	~VertexArray();
 
-	void SetActive() const;
+	// Size in bytes of one vertex of layout
+	static unsigned int GetVertexSize(Layout layout);
+
+	// Binds the vertex array (the index buffer is part of its state)
+	void SetActive();
+	// Draws every vertex (or index) as mode; the array must be bound
+	void Draw(unsigned int mode) const;
+
 	unsigned int GetNumIndices() const { return mNumIndices; }
 	unsigned int GetNumVerts() const { return mNumVerts; }
+	bool IsIndexed() const { return mNumIndices > 0; }
+	Layout GetLayout() const { return mLayout; }
+
+	void Upload();
+	bool IsUploaded() const { return mVertexArray != 0; }
+	unsigned int GetID() const { return mVertexArray; }
 
 private:
+
 	unsigned int mNumVerts;
 	unsigned int mNumIndices;
+	Layout mLayout;
 	unsigned int mVertexBuffer;
 	unsigned int mIndexBuffer;
 	unsigned int mVertexArray;
-};
\ No newline at end of file
+
+	// Waiting for Upload (emptied once uploaded)
+	std::vector<unsigned char> mPendingVerts;
+	std::vector<unsigned int> mPendingIndices;
+};
@@ -0,0 +1,179 @@
+#include "ActorRegistry.h"
+#include <algorithm>
+
+ActorRegistry::ActorRegistry()
+    : mFreeHead(ActorHandle::INVALID_INDEX)
+    , mIterating(false)
+{
+}
+
+ActorHandle ActorRegistry::Add(Actor* actor)
+{
+    uint32_t index;
+    if (mFreeHead != ActorHandle::INVALID_INDEX)
+    {
+        index = mFreeHead;
+        mFreeHead = mSlots[index].nextFree;
+    }
+    else
+    {
+        index = static_cast<uint32_t>(mSlots.size());
+        mSlots.push_back({ nullptr, 0, PENDING, ActorHandle::INVALID_INDEX });
+    }
+
+    Slot& slot = mSlots[index];
+    slot.actor = actor;
+
+    ActorHandle handle;
+    handle.index = index;
+    handle.generation = slot.generation;
+
+    if (mIterating)
+    {
+        slot.denseIndex = PENDING;
+        mPending.emplace_back(handle);
+    }
+    else
+    {
+        slot.denseIndex = static_cast<uint32_t>(mDense.size());
+        mDense.emplace_back(actor);
+        mDenseToSlot.emplace_back(index);
+    }
+
+    return handle;
+}
+
+void ActorRegistry::Remove(ActorHandle handle)
+{
+    if (!IsValid(handle))
+    {
+        return;
+    }
+
+    uint32_t denseIndex = mSlots[handle.index].denseIndex;
+    if (denseIndex != PENDING)
+    {
+        if (mIterating)
+        {
+            // Keep indices stable for the loop in progress
+            mDense[denseIndex] = nullptr;
+            mHoles.emplace_back(denseIndex);
+        }
+        else
+        {
+            EraseDense(denseIndex);
+        }
+    }
+    // Pending entries are skipped on flush once their handle goes stale
+
+    FreeSlot(handle.index);
+}
+
+Actor* ActorRegistry::Get(ActorHandle handle) const
+{
+    if (handle.index >= mSlots.size())
+    {
+        return nullptr;
+    }
+
+    const Slot& slot = mSlots[handle.index];
+    if (slot.generation != handle.generation)
+    {
+        return nullptr;
+    }
+
+    return slot.actor;
+}
+
+void ActorRegistry::BeginIteration()
+{
+    mIterating = true;
+}
+
+void ActorRegistry::EndIteration()
+{
+    mIterating = false;
+
+    // Fill holes from the back; after sorting, everything past the current
+    // hole is already compacted, so the swapped-in entry is always live
+    std::sort(mHoles.begin(), mHoles.end());
+    for (auto it = mHoles.rbegin(); it != mHoles.rend(); ++it)
+    {
+        EraseDense(*it);
+    }
+    mHoles.clear();
+
+    for (const auto& handle : mPending)
+    {
+        if (!IsValid(handle))
+        {
+            continue;
+        }
+
+        Slot& slot = mSlots[handle.index];
+        slot.denseIndex = static_cast<uint32_t>(mDense.size());
+        mDense.emplace_back(slot.actor);
+        mDenseToSlot.emplace_back(handle.index);
+    }
+    mPending.clear();
+}
+
+std::vector<Actor*> ActorRegistry::ReleaseAll()
+{
+    std::vector<Actor*> actors;
+    actors.reserve(mDense.size() + mPending.size());
+
+    for (auto* actor : mDense)
+    {
+        if (actor)
+        {
+            actors.emplace_back(actor);
+        }
+    }
+    for (const auto& handle : mPending)
+    {
+        if (Actor* actor = Get(handle))
+        {
+            actors.emplace_back(actor);
+        }
+    }
+
+    for (uint32_t i = 0; i < mSlots.size(); ++i)
+    {
+        if (mSlots[i].actor)
+        {
+            FreeSlot(i);
+        }
+    }
+
+    mDense.clear();
+    mDenseToSlot.clear();
+    mPending.clear();
+    mHoles.clear();
+
+    return actors;
+}
+
+void ActorRegistry::FreeSlot(uint32_t index)
+{
+    Slot& slot = mSlots[index];
+    slot.actor = nullptr;
+    slot.generation++;
+    slot.denseIndex = PENDING;
+    slot.nextFree = mFreeHead;
+    mFreeHead = index;
+}
+
+void ActorRegistry::EraseDense(uint32_t denseIndex)
+{
+    // Swap with the last entry and pop
+    uint32_t last = static_cast<uint32_t>(mDense.size()) - 1;
+    if (denseIndex != last)
+    {
+        mDense[denseIndex] = mDense[last];
+        mDenseToSlot[denseIndex] = mDenseToSlot[last];
+        mSlots[mDenseToSlot[denseIndex]].denseIndex = denseIndex;
+    }
+    mDense.pop_back();
+    mDenseToSlot.pop_back();
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Stable reference to an actor. The generation changes every time a slot is
+// reused, so a handle to a deleted actor never resolves to a newer one.
+struct ActorHandle
+{
+    uint32_t index = INVALID_INDEX;
+    uint32_t generation = 0;
+
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+    bool IsNull() const { return index == INVALID_INDEX; }
+    bool operator==(const ActorHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const ActorHandle& other) const { return !(*this == other); }
+};
+
+// Slot map owning the list of live actors.
+// Actors live densely packed in mDense (cheap iteration); handles point at a
+// slot that knows where its actor is in the dense array. Add and Remove are O(1).
+//
+// While iterating (BeginIteration/EndIteration) the dense array is never
+// reordered: new actors wait in a pending queue and removed actors leave a
+// null hole, both resolved in EndIteration.
+class ActorRegistry
+{
+public:
+    ActorRegistry();
+
+    ActorHandle Add(class Actor* actor);
+    void Remove(ActorHandle handle);
+
+    // Returns nullptr for stale or null handles
+    class Actor* Get(ActorHandle handle) const;
+    bool IsValid(ActorHandle handle) const { return Get(handle) != nullptr; }
+
+    void BeginIteration();
+    void EndIteration();
+    bool IsIterating() const { return mIterating; }
+
+    // Dense access; entries can be nullptr while iterating
+    size_t Size() const { return mDense.size(); }
+    class Actor* At(size_t i) const { return mDense[i]; }
+
+    // Invalidates every handle and returns all actors (live and pending) so
+    // the caller can delete them
+    std::vector<class Actor*> ReleaseAll();
+
+private:
+    static constexpr uint32_t PENDING = 0xFFFFFFFE;
+
+    struct Slot
+    {
+        class Actor* actor;
+        uint32_t generation;
+        uint32_t denseIndex;    // PENDING while waiting in mPending
+        uint32_t nextFree;
+    };
+
+    void FreeSlot(uint32_t index);
+    void EraseDense(uint32_t denseIndex);
+
+    std::vector<Slot> mSlots;
+    uint32_t mFreeHead;
+
+    std::vector<class Actor*> mDense;
+    std::vector<uint32_t> mDenseToSlot;
+
+    std::vector<ActorHandle> mPending;
+    std::vector<uint32_t> mHoles;
+    bool mIterating;
+};
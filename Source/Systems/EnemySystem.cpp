@@ -0,0 +1,182 @@
+#include "EnemySystem.h"
+#include "../Game.h"
+#include "../Actors/Enemy.h"
+#include "../Actors/Player.h"
+#include "../Components/RigidBodyComponent.h"
+#include "../Components/AnimatorComponent.h"
+
+void EnemySystem::Add(Enemy* enemy, EnemyKind kind, float radius, float speed, float health)
+{
+    enemy->SetListIndex(static_cast<int>(mEnemies.size()));
+
+    mEnemies.emplace_back(enemy);
+    mPositions.emplace_back(enemy->GetPosition());
+    mVelocities.emplace_back(Vector2::Zero);
+    mRadii.emplace_back(radius);
+    mHealth.emplace_back(health);
+    mMaxHealth.emplace_back(health);
+    mSpeeds.emplace_back(speed);
+    mDamage.emplace_back(10.0f);
+    mKinds.emplace_back(kind);
+    mChasesPlayer.emplace_back(1);
+}
+
+void EnemySystem::Remove(Enemy* enemy)
+{
+    // Stale or cleared indices are ignored, so removing twice is safe
+    int index = enemy->GetListIndex();
+    if (index < 0 || index >= static_cast<int>(mEnemies.size()) || mEnemies[index] != enemy)
+    {
+        return;
+    }
+
+    // Swap with the last enemy and pop
+    int last = static_cast<int>(mEnemies.size()) - 1;
+    if (index != last)
+    {
+        mEnemies[index] = mEnemies[last];
+        mPositions[index] = mPositions[last];
+        mVelocities[index] = mVelocities[last];
+        mRadii[index] = mRadii[last];
+        mHealth[index] = mHealth[last];
+        mMaxHealth[index] = mMaxHealth[last];
+        mSpeeds[index] = mSpeeds[last];
+        mDamage[index] = mDamage[last];
+        mKinds[index] = mKinds[last];
+        mChasesPlayer[index] = mChasesPlayer[last];
+        mEnemies[index]->SetListIndex(index);
+    }
+
+    mEnemies.pop_back();
+    mPositions.pop_back();
+    mVelocities.pop_back();
+    mRadii.pop_back();
+    mHealth.pop_back();
+    mMaxHealth.pop_back();
+    mSpeeds.pop_back();
+    mDamage.pop_back();
+    mKinds.pop_back();
+    mChasesPlayer.pop_back();
+
+    enemy->SetListIndex(-1);
+}
+
+void EnemySystem::Clear()
+{
+    // Cleared enemies no longer own a slot
+    for (Enemy* enemy : mEnemies)
+    {
+        enemy->SetListIndex(-1);
+    }
+
+    mEnemies.clear();
+    mPositions.clear();
+    mVelocities.clear();
+    mRadii.clear();
+    mHealth.clear();
+    mMaxHealth.clear();
+    mSpeeds.clear();
+    mDamage.clear();
+    mKinds.clear();
+    mChasesPlayer.clear();
+}
+
+void EnemySystem::Update(float deltaTime, Player* player, Game* game)
+{
+    const size_t count = mEnemies.size();
+
+    // Chase + contact damage (DPS leve ao encostar)
+    if (player && player->GetHealth() > 0.0f)
+    {
+        const Vector2 target = player->GetPosition();
+        float contactDamage = 0.0f;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (!mChasesPlayer[i] || mHealth[i] <= 0.0f)
+            {
+                continue;
+            }
+
+            Vector2 dir = target - mPositions[i];
+            float distanceSq = dir.LengthSq();
+            if (distanceSq > 0.0001f)
+            {
+                mVelocities[i] = dir * (mSpeeds[i] / Math::Sqrt(distanceSq));
+            }
+
+            float reach = mRadii[i] + CONTACT_MARGIN;
+            if (distanceSq <= reach * reach)
+            {
+                contactDamage += mDamage[i];
+            }
+        }
+
+        if (contactDamage > 0.0f)
+        {
+            player->TakeDamage(contactDamage * 0.5f * deltaTime); // suaviza por deltaTime
+            game->AddScreenShake(3.0f, 0.10f);
+        }
+    }
+
+    // Integration, same limits as RigidBodyComponent
+    const float maxSpeed = static_cast<float>(RigidBodyComponent::MAX_VELOCITY);
+    for (size_t i = 0; i < count; ++i)
+    {
+        Vector2& velocity = mVelocities[i];
+        float speedSq = velocity.LengthSq();
+        if (speedSq > maxSpeed * maxSpeed)
+        {
+            velocity *= maxSpeed / Math::Sqrt(speedSq);
+        }
+
+        mPositions[i] += velocity * deltaTime;
+
+        if (Math::Abs(velocity.x) < 0.01f) velocity.x = 0.0f;
+        if (Math::Abs(velocity.y) < 0.01f) velocity.y = 0.0f;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        mEnemies[i]->Actor::SetPosition(mPositions[i]);
+    }
+}
+
+void EnemySystem::Draw(Renderer* renderer, const Vector2& viewMin, const Vector2& viewMax)
+{
+    // Every enemy of a kind shares its sprite sheet
+    class Texture* textures[NUM_KINDS] = {};
+    for (auto& instances : mInstances)
+    {
+        instances.clear();
+    }
+
+    SpriteInstance instance;
+    // Culled on the position array first, so off-screen enemies are never touched
+    for (size_t i = 0; i < mEnemies.size(); ++i)
+    {
+        const Vector2& p = mPositions[i];
+        float reach = mRadii[i] + MAX_SPRITE_EXTENT;
+        if (p.x + reach < viewMin.x || p.x - reach > viewMax.x ||
+            p.y + reach < viewMin.y || p.y - reach > viewMax.y)
+        {
+            continue;
+        }
+
+        AnimatorComponent* animator = mEnemies[i]->GetAnimator();
+        if (!animator || !animator->IsInstanced() || !animator->GetInstance(instance))
+        {
+            continue;
+        }
+
+        int kind = static_cast<int>(mKinds[i]);
+        mInstances[kind].emplace_back(instance);
+        textures[kind] = animator->GetTexture();
+    }
+
+    for (int kind = 0; kind < NUM_KINDS; ++kind)
+    {
+        renderer->DrawSpriteInstances(textures[kind], mInstances[kind].data(),
+                                      static_cast<int>(mInstances[kind].size()));
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <vector>
+#include "../Math.h"
+#include "../Renderer/Renderer.h"
+
+// Count is not a kind: it sizes the per-kind arrays, so new kinds go before it
+enum class EnemyKind { Comum, Corredor, GordoExplosivo, Atirador, Count };
+
+// Simulation data for every live enemy, stored as parallel arrays.
+// Enemy actors keep rendering, shooting and death logic; the per-frame chase,
+// integration and contact damage run here as flat loops over the arrays.
+// Enemy::GetListIndex() is the enemy's index into every array.
+class EnemySystem
+{
+public:
+    // Extra reach added to the enemy radius for contact damage
+    static constexpr float CONTACT_MARGIN = 15.0f;
+
+    void Add(class Enemy* enemy, EnemyKind kind, float radius, float speed, float health);
+    void Remove(class Enemy* enemy);
+    void Clear();
+
+    // Number of EnemyKind values
+    static constexpr int NUM_KINDS = static_cast<int>(EnemyKind::Count);
+    // Draw order of the enemy animators; Draw runs when Game reaches this layer
+    static constexpr int DRAW_ORDER = 100;
+    // Sprites reach at most this far past the collider radius when culling
+    static constexpr float MAX_SPRITE_EXTENT = 32.0f;
+
+    // Steers chasing enemies toward the player, applies their contact damage,
+    // integrates every enemy and writes the new positions back to the actors
+    void Update(float deltaTime, class Player* player, class Game* game);
+
+    // Draws every enemy with an instanced animator inside the view rectangle,
+    // one instanced call per kind
+    void Draw(class Renderer* renderer, const Vector2& viewMin, const Vector2& viewMax);
+
+    const std::vector<class Enemy*>& GetEnemies() const { return mEnemies; }
+    size_t Size() const { return mEnemies.size(); }
+
+    const Vector2& GetPosition(int i) const { return mPositions[i]; }
+    void SetPosition(int i, const Vector2& position) { mPositions[i] = position; }
+
+    const Vector2& GetVelocity(int i) const { return mVelocities[i]; }
+    void SetVelocity(int i, const Vector2& velocity) { mVelocities[i] = velocity; }
+
+    float GetRadius(int i) const { return mRadii[i]; }
+    void SetRadius(int i, float radius) { mRadii[i] = radius; }
+
+    float GetHealth(int i) const { return mHealth[i]; }
+    void SetHealth(int i, float health) { mHealth[i] = health; }
+    float GetMaxHealth(int i) const { return mMaxHealth[i]; }
+    void SetMaxHealth(int i, float health) { mMaxHealth[i] = health; }
+
+    float GetSpeed(int i) const { return mSpeeds[i]; }
+    void SetSpeed(int i, float speed) { mSpeeds[i] = speed; }
+
+    float GetDamage(int i) const { return mDamage[i]; }
+    void SetDamage(int i, float damage) { mDamage[i] = damage; }
+
+    EnemyKind GetKind(int i) const { return mKinds[i]; }
+
+    // Enemies that drive their own velocity (bosses) are only integrated
+    bool GetChasesPlayer(int i) const { return mChasesPlayer[i] != 0; }
+    void SetChasesPlayer(int i, bool chases) { mChasesPlayer[i] = chases ? 1 : 0; }
+
+private:
+    std::vector<class Enemy*> mEnemies;
+    std::vector<Vector2> mPositions;
+    std::vector<Vector2> mVelocities;
+    std::vector<float> mRadii;
+    std::vector<float> mHealth;
+    std::vector<float> mMaxHealth;
+    std::vector<float> mSpeeds;
+    std::vector<float> mDamage;
+    std::vector<EnemyKind> mKinds;
+    std::vector<unsigned char> mChasesPlayer;
+
+    // Scratch instance lists for Draw, kept to avoid reallocating every frame
+    std::vector<SpriteInstance> mInstances[NUM_KINDS];
+};
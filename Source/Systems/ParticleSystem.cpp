@@ -0,0 +1,101 @@
+#include "ParticleSystem.h"
+#include "../Renderer/Renderer.h"
+
+namespace
+{
+    constexpr int FLOATS_PER_VERTEX = 5;
+    constexpr int VERTICES_PER_PARTICLE = 6;
+}
+
+ParticleSystem::ParticleSystem()
+    : mHead(0)
+    , mCount(0)
+{
+    mPositions.resize(MAX_PARTICLES);
+    mVelocities.resize(MAX_PARTICLES);
+    mColors.resize(MAX_PARTICLES);
+    mSizes.resize(MAX_PARTICLES);
+    mLifetimes.resize(MAX_PARTICLES);
+    mVertices.resize(MAX_PARTICLES * VERTICES_PER_PARTICLE * FLOATS_PER_VERTEX);
+}
+
+void ParticleSystem::Emit(const Vector2& position, const Vector2& velocity, const Vector3& color, float size,
+                          float lifetime)
+{
+    int i = mHead;
+    mPositions[i] = position;
+    mVelocities[i] = velocity;
+    mColors[i] = color;
+    mSizes[i] = size;
+    mLifetimes[i] = lifetime;
+
+    // Buffer cheio: sobrescreve a partícula mais antiga
+    mHead = (mHead + 1) % MAX_PARTICLES;
+    if (mCount < MAX_PARTICLES)
+    {
+        mCount++;
+    }
+}
+
+void ParticleSystem::Update(float deltaTime)
+{
+    for (int n = 0; n < mCount; ++n)
+    {
+        int i = SlotOf(n);
+        mPositions[i] += mVelocities[i] * deltaTime;
+        mLifetimes[i] -= deltaTime;
+    }
+
+    // Shrink the live range from the oldest end; particles that die out of
+    // order are skipped when drawing until the range reaches them
+    while (mCount > 0 && mLifetimes[SlotOf(0)] <= 0.0f)
+    {
+        mCount--;
+    }
+}
+
+void ParticleSystem::Draw(Renderer* renderer, const Vector2& viewMin, const Vector2& viewMax)
+{
+    float* out = mVertices.data();
+    int numVertices = 0;
+
+    for (int n = 0; n < mCount; ++n)
+    {
+        int i = SlotOf(n);
+        if (mLifetimes[i] <= 0.0f)
+        {
+            continue;
+        }
+
+        const Vector2& p = mPositions[i];
+        const Vector3& c = mColors[i];
+        const float s = mSizes[i];
+        if (p.x + s < viewMin.x || p.x - s > viewMax.x || p.y + s < viewMin.y || p.y - s > viewMax.y)
+        {
+            continue;
+        }
+
+        const float corners[VERTICES_PER_PARTICLE][2] = {
+            { p.x - s, p.y - s }, { p.x + s, p.y - s }, { p.x + s, p.y + s },
+            { p.x + s, p.y + s }, { p.x - s, p.y + s }, { p.x - s, p.y - s }
+        };
+
+        for (const auto& corner : corners)
+        {
+            *out++ = corner[0];
+            *out++ = corner[1];
+            *out++ = c.x;
+            *out++ = c.y;
+            *out++ = c.z;
+        }
+        numVertices += VERTICES_PER_PARTICLE;
+    }
+
+    renderer->DrawParticles(mVertices.data(), numVertices);
+}
+
+void ParticleSystem::Clear()
+{
+    mHead = 0;
+    mCount = 0;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <vector>
+#include "../Math.h"
+
+// Fixed-capacity ring buffer of simple coloured square particles.
+// Storage is allocated once; when the buffer is full the oldest particle is
+// overwritten, so Emit never allocates. Every live particle is written to one
+// vertex buffer and drawn with a single call.
+class ParticleSystem
+{
+public:
+    static constexpr int MAX_PARTICLES = 2048;
+
+    ParticleSystem();
+
+    void Emit(const Vector2& position, const Vector2& velocity, const Vector3& color, float size, float lifetime);
+
+    // Moves and ages every live particle
+    void Update(float deltaTime);
+    // Particles outside the view rectangle are not written to the vertex buffer
+    void Draw(class Renderer* renderer, const Vector2& viewMin, const Vector2& viewMax);
+
+    void Clear();
+    int GetCount() const { return mCount; }
+
+private:
+    // Slot of the i-th live particle, oldest first
+    int SlotOf(int i) const { return (mHead - mCount + i + MAX_PARTICLES) % MAX_PARTICLES; }
+
+    int mHead;      // next slot to be written
+    int mCount;     // live range ending at mHead
+
+    std::vector<Vector2> mPositions;
+    std::vector<Vector2> mVelocities;
+    std::vector<Vector3> mColors;
+    std::vector<float> mSizes;
+    std::vector<float> mLifetimes;
+
+    // x, y, r, g, b for 6 vertices per particle
+    std::vector<float> mVertices;
+};
@@ -0,0 +1,76 @@
+#pragma once
+#include <SDL.h>
+
+// Simulation stages timed every step, in update order
+enum class ProfileSection
+{
+    Enemies,
+    Grids,
+    Projectiles,
+    Particles,
+    Actors,
+    Waves,
+    Count
+};
+
+// Accumulates time spent in each simulation stage with the SDL performance
+// counter. Cheap enough to stay on in normal builds; the bench reads it.
+class Profiler
+{
+public:
+    static const int NUM_SECTIONS = static_cast<int>(ProfileSection::Count);
+
+    Profiler() { Reset(); }
+
+    void Reset()
+    {
+        for (auto& ticks : mTicks)
+        {
+            ticks = 0;
+        }
+    }
+
+    void Add(ProfileSection section, Uint64 ticks) { mTicks[static_cast<int>(section)] += ticks; }
+
+    double GetSeconds(ProfileSection section) const
+    {
+        return static_cast<double>(mTicks[static_cast<int>(section)]) /
+               static_cast<double>(SDL_GetPerformanceFrequency());
+    }
+
+    static const char* GetName(ProfileSection section)
+    {
+        switch (section)
+        {
+            case ProfileSection::Enemies:     return "enemies";
+            case ProfileSection::Grids:       return "grids";
+            case ProfileSection::Projectiles: return "projectiles";
+            case ProfileSection::Particles:   return "particles";
+            case ProfileSection::Actors:      return "actors";
+            case ProfileSection::Waves:       return "waves";
+            default:                          return "?";
+        }
+    }
+
+private:
+    Uint64 mTicks[NUM_SECTIONS];
+};
+
+// Adds the time between construction and destruction to a section
+class ScopedProfile
+{
+public:
+    ScopedProfile(Profiler& profiler, ProfileSection section)
+        : mProfiler(profiler)
+        , mSection(section)
+        , mStart(SDL_GetPerformanceCounter())
+    {
+    }
+
+    ~ScopedProfile() { mProfiler.Add(mSection, SDL_GetPerformanceCounter() - mStart); }
+
+private:
+    Profiler& mProfiler;
+    ProfileSection mSection;
+    Uint64 mStart;
+};
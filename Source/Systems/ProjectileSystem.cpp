@@ -0,0 +1,320 @@
+#include "ProjectileSystem.h"
+#include "../Game.h"
+#include "../Actors/Enemy.h"
+#include "../Actors/Player.h"
+#include "../Components/CircleColliderComponent.h"
+#include "../Components/RigidBodyComponent.h"
+#include "../Renderer/Renderer.h"
+
+ProjectileSystem::ProjectileSystem()
+    : mCount(0)
+    , mTexture(nullptr)
+    , mTextureRegion(Vector4::UnitRect)
+{
+    mPositions.resize(MAX_PROJECTILES);
+    mPrevPositions.resize(MAX_PROJECTILES);
+    mDirections.resize(MAX_PROJECTILES);
+    mSpeeds.resize(MAX_PROJECTILES);
+    mLifetimes.resize(MAX_PROJECTILES);
+    mDamage.resize(MAX_PROJECTILES);
+    mPierceRemaining.resize(MAX_PROJECTILES);
+    mFlags.resize(MAX_PROJECTILES);
+    mHits.resize(MAX_PROJECTILES * MAX_TRACKED_HITS);
+    mNumHits.resize(MAX_PROJECTILES);
+    mHitOverflow.resize(MAX_PROJECTILES);
+}
+
+bool ProjectileSystem::Spawn(const Vector2& position, const Vector2& direction, float speed, bool fromPlayer,
+                             float damage, int pierce, bool homing, bool explosive)
+{
+    if (mCount >= MAX_PROJECTILES)
+    {
+        return false;
+    }
+
+    int i = mCount++;
+
+    Vector2 dir = direction;
+    if (dir.LengthSq() > 0.0f)
+    {
+        dir.Normalize();
+    }
+    else
+    {
+        dir = Vector2(1.0f, 0.0f);  // Default direction
+    }
+
+    mPositions[i] = position;
+    mPrevPositions[i] = position;
+    mDirections[i] = dir;
+    // Same cap the old RigidBodyComponent applied
+    mSpeeds[i] = Math::Min(speed, static_cast<float>(RigidBodyComponent::MAX_VELOCITY));
+    mLifetimes[i] = LIFETIME;
+    mDamage[i] = damage;
+    mPierceRemaining[i] = pierce;
+    mFlags[i] = (fromPlayer ? FROM_PLAYER : 0) | (homing ? HOMING : 0) | (explosive ? EXPLOSIVE : 0);
+    mNumHits[i] = 0;
+    mHitOverflow[i].clear();
+
+    return true;
+}
+
+void ProjectileSystem::Update(float deltaTime, Game* game)
+{
+    Player* player = game->GetPlayer();
+
+    for (int i = 0; i < mCount; ++i)
+    {
+        if ((mFlags[i] & (HOMING | FROM_PLAYER)) == (HOMING | FROM_PLAYER))
+        {
+            UpdateHoming(i, deltaTime, game);
+        }
+    }
+
+    for (int i = 0; i < mCount; ++i)
+    {
+        mPrevPositions[i] = mPositions[i];
+        mPositions[i] += mDirections[i] * (mSpeeds[i] * deltaTime);
+        mLifetimes[i] -= deltaTime;
+    }
+
+    for (int i = 0; i < mCount; ++i)
+    {
+        // vida do projétil
+        if (mLifetimes[i] <= 0.0f)
+        {
+            mFlags[i] |= DEAD;
+            continue;
+        }
+
+        // colisão
+        if (mFlags[i] & FROM_PLAYER)
+        {
+            HitEnemies(i, game);
+        }
+        else if (player)
+        {
+            HitPlayer(i, player);
+        }
+
+        // remover se sair dos limites do mundo
+        const Vector2& pos = mPositions[i];
+        if (pos.x < -100 || pos.x > Game::WORLD_WIDTH + 100 ||
+            pos.y < -100 || pos.y > Game::WORLD_HEIGHT + 100)
+        {
+            mFlags[i] |= DEAD;
+        }
+    }
+
+    // Compact: dead projectiles are replaced by the last live one
+    int i = 0;
+    while (i < mCount)
+    {
+        if (mFlags[i] & DEAD)
+        {
+            MoveLast(i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+void ProjectileSystem::Draw(Renderer* renderer, float alpha, const Vector2& viewMin, const Vector2& viewMax) const
+{
+    if (!mTexture)
+    {
+        return;
+    }
+
+    // Shot.png is a single 16x16 frame, drawn flipped vertically like the sprite actors
+    const Vector2 size(16.0f, 16.0f);
+    const Vector4 rect(mTextureRegion.x, mTextureRegion.y + mTextureRegion.w, mTextureRegion.z, -mTextureRegion.w);
+
+    const float reach = size.x;
+    for (int i = 0; i < mCount; ++i)
+    {
+        Vector2 position = Vector2::Lerp(mPrevPositions[i], mPositions[i], alpha);
+        if (position.x + reach < viewMin.x || position.x - reach > viewMax.x ||
+            position.y + reach < viewMin.y || position.y - reach > viewMax.y)
+        {
+            continue;
+        }
+        renderer->DrawTexture(position, size, 0.0f, Vector3::One, mTexture, rect);
+    }
+}
+
+void ProjectileSystem::UpdateHoming(int i, float deltaTime, Game* game)
+{
+    // Find nearest enemy not hit yet
+    Enemy* nearestEnemy = nullptr;
+    float nearestDistance = HOMING_RANGE * HOMING_RANGE;
+    const Vector2 position = mPositions[i];
+
+    game->GetEnemyGrid().ForEachNear(position, HOMING_RANGE, [&](Enemy* enemy)
+    {
+        if (enemy->GetState() != ActorState::Active) return;
+
+        // Skip enemies we've already hit
+        if (HasHit(i, enemy->GetHandle())) return;
+
+        float dist = (enemy->GetPosition() - position).LengthSq();
+        if (dist < nearestDistance)
+        {
+            nearestDistance = dist;
+            nearestEnemy = enemy;
+        }
+    });
+
+    if (!nearestEnemy)
+    {
+        return;
+    }
+
+    Vector2 toEnemy = nearestEnemy->GetPosition() - position;
+    toEnemy.Normalize();
+
+    // Gradually turn toward enemy
+    Vector2& direction = mDirections[i];
+    float currentAngle = Math::Atan2(direction.y, direction.x);
+    float targetAngle = Math::Atan2(toEnemy.y, toEnemy.x);
+
+    // Normalize angles
+    float angleDiff = targetAngle - currentAngle;
+    while (angleDiff > Math::Pi) angleDiff -= Math::TwoPi;
+    while (angleDiff < -Math::Pi) angleDiff += Math::TwoPi;
+
+    // Turn toward target
+    float turnAmount = HOMING_TURN_RATE * deltaTime;
+    if (Math::Abs(angleDiff) < turnAmount)
+    {
+        direction = toEnemy;
+    }
+    else
+    {
+        float newAngle = currentAngle + (angleDiff > 0 ? turnAmount : -turnAmount);
+        direction = Vector2(Math::Cos(newAngle), Math::Sin(newAngle));
+    }
+}
+
+void ProjectileSystem::HitEnemies(int i, Game* game)
+{
+    // projétil do jogador acerta inimigos
+    const Vector2 position = mPositions[i];
+    Player* player = game->GetPlayer();
+
+    game->GetEnemyGrid().ForEachNear(position, RADIUS, [&](Enemy* e)
+    {
+        if ((mFlags[i] & DEAD) || e->GetState() != ActorState::Active) return;
+
+        // Skip enemies we've already hit (for pierce)
+        ActorHandle handle = e->GetHandle();
+        if (HasHit(i, handle)) return;
+
+        float radiusSum = RADIUS + e->GetRadius();
+        if ((e->GetPosition() - position).LengthSq() > radiusSum * radiusSum) return;
+
+        float actualDamage = e->TakeDamage(mDamage[i]);
+
+        // Lifesteal - heal player based on damage dealt
+        if (player && player->HasLifesteal())
+        {
+            player->Heal(actualDamage * player->GetLifestealPercent());
+        }
+
+        // Track hit enemy for pierce system
+        RecordHit(i, handle);
+
+        // Check pierce
+        if (mPierceRemaining[i] > 0)
+        {
+            mPierceRemaining[i]--;  // Continue through enemy
+        }
+        else
+        {
+            mFlags[i] |= DEAD;  // No pierce left
+        }
+    });
+}
+
+void ProjectileSystem::HitPlayer(int i, Player* player)
+{
+    // projétil inimigo acerta o jogador
+    if (player->GetState() != ActorState::Active)
+    {
+        return;
+    }
+
+    auto* playerCol = player->GetCollider();
+    if (!playerCol)
+    {
+        return;
+    }
+
+    float radiusSum = RADIUS + playerCol->GetRadius();
+    if ((player->GetPosition() - mPositions[i]).LengthSq() <= radiusSum * radiusSum)
+    {
+        player->TakeDamage(mDamage[i]);
+        mFlags[i] |= DEAD;
+    }
+}
+
+bool ProjectileSystem::HasHit(int i, ActorHandle enemy) const
+{
+    int num = Math::Min(mNumHits[i], MAX_TRACKED_HITS);
+    const ActorHandle* hits = &mHits[i * MAX_TRACKED_HITS];
+    for (int h = 0; h < num; ++h)
+    {
+        if (hits[h] == enemy)
+        {
+            return true;
+        }
+    }
+    for (const ActorHandle& hit : mHitOverflow[i])
+    {
+        if (hit == enemy)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ProjectileSystem::RecordHit(int i, ActorHandle enemy)
+{
+    if (mNumHits[i] < MAX_TRACKED_HITS)
+    {
+        mHits[i * MAX_TRACKED_HITS + mNumHits[i]] = enemy;
+    }
+    else
+    {
+        mHitOverflow[i].push_back(enemy);
+    }
+    mNumHits[i]++;
+}
+
+void ProjectileSystem::MoveLast(int to)
+{
+    int last = --mCount;
+    if (to == last)
+    {
+        return;
+    }
+
+    mPositions[to] = mPositions[last];
+    mPrevPositions[to] = mPrevPositions[last];
+    mDirections[to] = mDirections[last];
+    mSpeeds[to] = mSpeeds[last];
+    mLifetimes[to] = mLifetimes[last];
+    mDamage[to] = mDamage[last];
+    mPierceRemaining[to] = mPierceRemaining[last];
+    mFlags[to] = mFlags[last];
+    mNumHits[to] = mNumHits[last];
+    for (int h = 0; h < MAX_TRACKED_HITS; ++h)
+    {
+        mHits[to * MAX_TRACKED_HITS + h] = mHits[last * MAX_TRACKED_HITS + h];
+    }
+    // Swap so both slots keep an allocated buffer
+    mHitOverflow[to].swap(mHitOverflow[last]);
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include <vector>
+#include "../Math.h"
+#include "ActorRegistry.h"
+
+// Fixed-capacity pool of projectiles stored as parallel arrays.
+// All storage is allocated once in the constructor; Spawn writes to the end
+// of the live range and dead projectiles are swap-removed at the end of
+// Update, so neither allocates. The only exception is a piercing projectile
+// that hits more than MAX_TRACKED_HITS enemies, whose extra hits grow a
+// per-slot overflow list (kept for reuse). Projectiles are not actors.
+class ProjectileSystem
+{
+public:
+    static constexpr int MAX_PROJECTILES = 4096;
+    // Enemies remembered inline per projectile for pierce; more spill into
+    // the overflow list, so no enemy is hit twice by the same projectile
+    static constexpr int MAX_TRACKED_HITS = 8;
+
+    static constexpr float RADIUS = 8.0f;
+    static constexpr float LIFETIME = 2.0f;
+    static constexpr float HOMING_TURN_RATE = 4.5f;   // radians per second
+    static constexpr float HOMING_RANGE = 100.0f;
+
+    ProjectileSystem();
+
+    // region is the normalized rect of Shot.png inside texture (an atlas page)
+    void SetTexture(class Texture* texture, const Vector4& region)
+    {
+        mTexture = texture;
+        mTextureRegion = region;
+    }
+
+    // Returns false (and drops the projectile) when the pool is full
+    bool Spawn(const Vector2& position, const Vector2& direction, float speed, bool fromPlayer,
+               float damage, int pierce, bool homing, bool explosive);
+
+    // Homing, movement, lifetime, hits against enemies/player and world culling
+    void Update(float deltaTime, class Game* game);
+    // Positions are interpolated from the previous step by alpha; projectiles
+    // outside the view rectangle are skipped
+    void Draw(class Renderer* renderer, float alpha, const Vector2& viewMin, const Vector2& viewMax) const;
+
+    void Clear() { mCount = 0; }
+    int GetCount() const { return mCount; }
+
+private:
+    enum Flags : unsigned char
+    {
+        FROM_PLAYER = 1 << 0,
+        HOMING      = 1 << 1,
+        EXPLOSIVE   = 1 << 2,
+        DEAD        = 1 << 3
+    };
+
+    void UpdateHoming(int i, float deltaTime, class Game* game);
+    void HitEnemies(int i, class Game* game);
+    void HitPlayer(int i, class Player* player);
+    bool HasHit(int i, ActorHandle enemy) const;
+    void RecordHit(int i, ActorHandle enemy);
+    void MoveLast(int to);
+
+    int mCount;
+    class Texture* mTexture;
+    Vector4 mTextureRegion;
+
+    std::vector<Vector2> mPositions;
+    std::vector<Vector2> mPrevPositions;
+    std::vector<Vector2> mDirections;
+    std::vector<float> mSpeeds;
+    std::vector<float> mLifetimes;
+    std::vector<float> mDamage;
+    std::vector<int> mPierceRemaining;
+    std::vector<unsigned char> mFlags;
+
+    // MAX_TRACKED_HITS entries per projectile, then mHitOverflow[i]
+    std::vector<ActorHandle> mHits;
+    std::vector<int> mNumHits;
+    std::vector<std::vector<ActorHandle>> mHitOverflow;
+};
@@ -0,0 +1,141 @@
+#pragma once
+#include <vector>
+#include "../Math.h"
+
+// Uniform grid over the world used as a collision broadphase.
+// It is rebuilt from scratch every frame: Clear(), Insert() every item and
+// then Build(), which lays the items out contiguously per cell.
+// Items wider than half a cell (bosses) are kept in a separate list that every
+// query checks directly, so they don't widen the cell range of every query.
+template <typename T>
+class SpatialGrid
+{
+public:
+    SpatialGrid(float worldWidth, float worldHeight, float cellSize)
+        : mCellSize(cellSize)
+        , mInvCellSize(1.0f / cellSize)
+        , mNumCellsX(static_cast<int>(std::ceil(worldWidth / cellSize)))
+        , mNumCellsY(static_cast<int>(std::ceil(worldHeight / cellSize)))
+        , mMaxRadius(0.0f)
+        , mLargeRadius(0.5f * cellSize)
+    {
+        mCellStart.assign(mNumCellsX * mNumCellsY + 1, 0);
+    }
+
+    void Clear()
+    {
+        mEntries.clear();
+        mCellItems.clear();
+        mCellStart.assign(mCellStart.size(), 0);
+        mLargeItems.clear();
+        mMaxRadius = 0.0f;
+    }
+
+    // Radius is the item's extent; queries grow by the largest radius in the
+    // cells (at most half a cell) so anything that could overlap the query
+    // circle is reported.
+    void Insert(T* item, const Vector2& position, float radius)
+    {
+        if (radius > mLargeRadius)
+        {
+            mLargeItems.push_back({ item, position, radius });
+            return;
+        }
+
+        mEntries.push_back({ item, CellIndex(CellX(position.x), CellY(position.y)) });
+        if (radius > mMaxRadius)
+        {
+            mMaxRadius = radius;
+        }
+    }
+
+    void Build()
+    {
+        // Counting sort of the entries by cell
+        for (const auto& entry : mEntries)
+        {
+            mCellStart[entry.cell + 1]++;
+        }
+        for (size_t i = 1; i < mCellStart.size(); ++i)
+        {
+            mCellStart[i] += mCellStart[i - 1];
+        }
+
+        mCellItems.resize(mEntries.size());
+        mCursor.assign(mCellStart.begin(), mCellStart.end() - 1);
+        for (const auto& entry : mEntries)
+        {
+            mCellItems[mCursor[entry.cell]++] = entry.item;
+        }
+    }
+
+    // Calls func(T*) for every item whose cell may overlap the circle.
+    // Callers still do the exact test.
+    template <typename Func>
+    void ForEachNear(const Vector2& center, float radius, Func func) const
+    {
+        float reach = radius + mMaxRadius;
+        int minX = CellX(center.x - reach);
+        int maxX = CellX(center.x + reach);
+        int minY = CellY(center.y - reach);
+        int maxY = CellY(center.y + reach);
+
+        for (int y = minY; y <= maxY; ++y)
+        {
+            for (int x = minX; x <= maxX; ++x)
+            {
+                int cell = CellIndex(x, y);
+                for (int i = mCellStart[cell]; i < mCellStart[cell + 1]; ++i)
+                {
+                    func(mCellItems[i]);
+                }
+            }
+        }
+
+        for (const auto& large : mLargeItems)
+        {
+            float reachLarge = radius + large.radius;
+            if ((large.position - center).LengthSq() <= reachLarge * reachLarge)
+            {
+                func(large.item);
+            }
+        }
+    }
+
+    float GetCellSize() const { return mCellSize; }
+    size_t GetNumItems() const { return mCellItems.size() + mLargeItems.size(); }
+
+private:
+    // Positions outside the world are clamped to the border cells
+    int CellX(float x) const { return Math::Clamp(static_cast<int>(x * mInvCellSize), 0, mNumCellsX - 1); }
+    int CellY(float y) const { return Math::Clamp(static_cast<int>(y * mInvCellSize), 0, mNumCellsY - 1); }
+    int CellIndex(int x, int y) const { return y * mNumCellsX + x; }
+
+    struct Entry
+    {
+        T* item;
+        int cell;
+    };
+
+    struct LargeEntry
+    {
+        T* item;
+        Vector2 position;
+        float radius;
+    };
+
+    float mCellSize;
+    float mInvCellSize;
+    int mNumCellsX;
+    int mNumCellsY;
+    // Largest radius among the items in cells
+    float mMaxRadius;
+    // Items above this radius go to mLargeItems
+    float mLargeRadius;
+
+    std::vector<Entry> mEntries;
+    std::vector<LargeEntry> mLargeItems;
+    std::vector<int> mCellStart;
+    std::vector<int> mCursor;
+    std::vector<T*> mCellItems;
+};